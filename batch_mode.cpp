@@ -0,0 +1,335 @@
+#include "batch_mode.h"
+#include "date_clock.h"
+#include "date_parallel.h"
+#include "date_parse.h"
+#include "date_period.h"
+#include "date_random.h"
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace project {
+
+    // Helper functions
+    namespace {
+        constexpr std::size_t piece_bytes = 64 << 10;   // iş parçacığı başına iş birimi
+        // Tek generate-random satırının üretebileceği en fazla tarih; çıktı
+        // parça parça bellekte biriktiği için sınırsız olamaz (~11 MB)
+        constexpr std::uint64_t max_random_count = 1'000'000;
+
+        // Geçerli tarihlerin seri numarası aralığı
+        constexpr int first_serial = civil::days_from_civil(1, 1, Date::year_base);
+        constexpr int last_serial = civil::days_from_civil(31, 12, Date::max_year);
+
+        struct Context {
+            const BatchOptions& options;
+            Date today;
+        };
+
+        bool is_separator(char c) noexcept {
+            return c == ' ' || c == '\t' || c == ',' || c == '\r';
+        }
+
+        // En fazla max_tokens alan; fazlası hatadır (count > max_tokens)
+        std::size_t split(std::string_view line, std::string_view* tokens, std::size_t max_tokens) noexcept {
+            std::size_t count = 0;
+            std::size_t i = 0;
+            while (i < line.size()) {
+                while (i < line.size() && is_separator(line[i])) {
+                    ++i;
+                }
+                if (i == line.size()) {
+                    break;
+                }
+                const std::size_t start = i;
+                while (i < line.size() && !is_separator(line[i])) {
+                    ++i;
+                }
+                if (count < max_tokens) {
+                    tokens[count] = line.substr(start, i - start);
+                }
+                ++count;
+            }
+            return count;
+        }
+
+        template<typename T>
+        bool parse_number(std::string_view token, T& value) noexcept {
+            const char* last = token.data() + token.size();
+            const std::from_chars_result r = std::from_chars(token.data(), last, value);
+            return r.ec == std::errc{} && r.ptr == last;
+        }
+
+        void append_date(std::string& out, const Date& date, DateFormat fmt) {
+            char buf[max_date_chars];
+            out.append(buf, static_cast<std::size_t>(to_chars(buf, buf + sizeof(buf), date, fmt).ptr - buf));
+            out += '\n';
+        }
+
+        template<typename T>
+        void append_number(std::string& out, T value) {
+            char buf[24];
+            out.append(buf, static_cast<std::size_t>(std::to_chars(buf, buf + sizeof(buf), value).ptr - buf));
+        }
+
+        bool fail(std::string& out, std::string_view message) {
+            out += "ERR ";
+            out += message;
+            out += '\n';
+            return false;
+        }
+
+        bool parse_date_token(std::string_view token, Date& date, std::string& out) {
+            const DateResult r = try_parse_date(token);
+            if (!r) {
+                return fail(out, to_string(r.error()));
+            }
+            date = *r;
+            return true;
+        }
+
+        // Satırı işler; hata satırı yazıldıysa false
+        bool run_command(std::string_view line, const Context& ctx, std::string& out) {
+            std::string_view t[4];
+            const std::size_t n = split(line, t, 4);
+            const std::string_view cmd = t[0];
+            const DateFormat fmt = ctx.options.format;
+
+            if (cmd == "age") {
+                Date birth, ref = ctx.today;
+                if (n < 2 || n > 3) {
+                    return fail(out, "Kullanim: age <dogum> [referans]");
+                }
+                if (!parse_date_token(t[1], birth, out) || (n == 3 && !parse_date_token(t[2], ref, out))) {
+                    return false;
+                }
+                if (ref < birth) {
+                    return fail(out, "Dogum tarihi gelecekte olamaz");
+                }
+                const Period age = period_between(birth, ref);
+                append_number(out, age.years);
+                out += ' ';
+                append_number(out, age.months);
+                out += ' ';
+                append_number(out, age.days);
+                out += '\n';
+                return true;
+            }
+            if (cmd == "diff") {
+                Date d1, d2;
+                if (n != 3) {
+                    return fail(out, "Kullanim: diff <tarih1> <tarih2>");
+                }
+                if (!parse_date_token(t[1], d1, out) || !parse_date_token(t[2], d2, out)) {
+                    return false;
+                }
+                append_number(out, d2 - d1);
+                out += '\n';
+                return true;
+            }
+            if (cmd == "add-days" || cmd == "add") {
+                Date date;
+                int days;
+                if (n != 3) {
+                    return fail(out, "Kullanim: add-days <tarih> <gun>");
+                }
+                if (!parse_date_token(t[1], date, out)) {
+                    return false;
+                }
+                if (!parse_number(t[2], days)) {
+                    return fail(out, "Hatali sayi");
+                }
+                // Toplam int'e ve geçerli aralığa sığmıyorsa Date'e hiç eklenmez
+                const long long serial = static_cast<long long>(date.get_day_serial()) + days;
+                if (serial < first_serial || serial > last_serial) {
+                    return fail(out, to_string(DateErrc::invalid_year));
+                }
+                append_date(out, Date::from_day_serial(static_cast<int>(serial)), fmt);
+                return true;
+            }
+            if (cmd == "leap-check" || cmd == "leap") {
+                int year;
+                if (n != 2) {
+                    return fail(out, "Kullanim: leap-check <yil>");
+                }
+                if (!parse_number(t[1], year)) {
+                    return fail(out, "Hatali sayi");
+                }
+                out += Date::isleap(year) ? "1\n" : "0\n";
+                return true;
+            }
+            if (cmd == "weekday") {
+                Date date;
+                if (n != 2) {
+                    return fail(out, "Kullanim: weekday <tarih>");
+                }
+                if (!parse_date_token(t[1], date, out)) {
+                    return false;
+                }
+                out += weekday_name(date.get_week_day());
+                out += '\n';
+                return true;
+            }
+            if (cmd == "generate-random" || cmd == "random") {
+                std::uint64_t count;
+                std::uint64_t seed;
+                if (n < 2 || n > 3) {
+                    return fail(out, "Kullanim: generate-random <adet> [tohum]");
+                }
+                if (!parse_number(t[1], count) || (n == 3 && !parse_number(t[2], seed))) {
+                    return fail(out, "Hatali sayi");
+                }
+                if (count > max_random_count) {
+                    return fail(out, "Adet en fazla 1000000 olabilir");
+                }
+                if (n == 3) {
+                    // Tohumlu üretim tekrarlanabilir
+                    DateGenerator generator(seed);
+                    for (std::uint64_t i = 0; i < count; ++i) {
+                        append_date(out, generator.next(), fmt);
+                    }
+                } else {
+                    for (std::uint64_t i = 0; i < count; ++i) {
+                        append_date(out, Date::random_date(), fmt);
+                    }
+                }
+                return true;
+            }
+            return fail(out, "Bilinmeyen komut");
+        }
+
+        void run_piece(const char* p, const char* last, const Context& ctx,
+                       std::string& out, BatchStats& stats) {
+            out.reserve(static_cast<std::size_t>(last - p));
+            while (p < last) {
+                const void* nl = std::memchr(p, '\n', static_cast<std::size_t>(last - p));
+                const char* end = nl ? static_cast<const char*>(nl) : last;
+                std::string_view line(p, static_cast<std::size_t>(end - p));
+                p = end + 1;
+
+                const std::size_t first = line.find_first_not_of(" \t\r");
+                if (first == std::string_view::npos || line[first] == '#') {
+                    continue;
+                }
+                ++stats.lines;
+                if (!run_command(line.substr(first), ctx, out)) {
+                    ++stats.errors;
+                }
+            }
+        }
+    }
+
+    BatchStats run_batch(std::FILE* in, std::FILE* out, const BatchOptions& options) {
+        const Context ctx{ options, today() };
+        BatchStats stats;
+        std::vector<char> buffer(options.block_bytes != 0 ? options.block_bytes : piece_bytes);
+        std::size_t carry = 0;
+        bool eof = false;
+
+        while (!eof || carry != 0) {
+            const std::size_t n = eof ? 0 : std::fread(buffer.data() + carry, 1, buffer.size() - carry, in);
+            eof = eof || carry + n < buffer.size();
+            const std::size_t size = carry + n;
+
+            // Yalnızca tam satırlar işlenir; son yarım satır bir sonraki bloğa kalır
+            std::size_t end = size;
+            if (!eof) {
+                while (end > 0 && buffer[end - 1] != '\n') {
+                    --end;
+                }
+                if (end == 0) {
+                    buffer.resize(buffer.size() * 2);   // bloktan uzun satır
+                    carry = size;
+                    continue;
+                }
+            }
+
+            // Parçalar satır sonuna hizalanır ve çıktıları sırayla yazılır
+            std::vector<std::size_t> cuts{ 0 };
+            while (cuts.back() < end) {
+                std::size_t cut = cuts.back() + piece_bytes;
+                if (cut >= end) {
+                    cut = end;
+                } else {
+                    const void* nl = std::memchr(buffer.data() + cut, '\n', end - cut);
+                    cut = nl ? static_cast<std::size_t>(static_cast<const char*>(nl) - buffer.data()) + 1 : end;
+                }
+                cuts.push_back(cut);
+            }
+            const std::size_t pieces = cuts.size() - 1;
+            std::vector<std::string> outputs(pieces);
+            std::vector<BatchStats> piece_stats(pieces);
+            parallel::for_each_task(pieces, options.threads, [&](std::size_t i) {
+                run_piece(buffer.data() + cuts[i], buffer.data() + cuts[i + 1], ctx, outputs[i], piece_stats[i]);
+            });
+            for (std::size_t i = 0; i < pieces; ++i) {
+                std::fwrite(outputs[i].data(), 1, outputs[i].size(), out);
+                stats.lines += piece_stats[i].lines;
+                stats.errors += piece_stats[i].errors;
+            }
+
+            carry = size - end;
+            std::memmove(buffer.data(), buffer.data() + end, carry);
+        }
+        std::fflush(out);
+        return stats;
+    }
+
+    int run_batch_main(int argc, char* argv[]) {
+        BatchOptions options;
+        std::vector<const char*> files;
+        for (int i = 0; i < argc; ++i) {
+            const std::string_view arg = argv[i];
+            if ((arg == "-t" || arg == "--threads") && i + 1 < argc) {
+                if (!parse_number(std::string_view(argv[++i]), options.threads)) {
+                    std::fprintf(stderr, "Hatali is parcacigi sayisi: %s\n", argv[i]);
+                    return 2;
+                }
+            } else if (arg == "--format" && i + 1 < argc) {
+                const std::string_view fmt = argv[++i];
+                if (fmt == "dmy") {
+                    options.format = DateFormat::dmy;
+                } else if (fmt == "iso") {
+                    options.format = DateFormat::iso;
+                } else if (fmt == "long") {
+                    options.format = DateFormat::turkish_long;
+                } else {
+                    std::fprintf(stderr, "Bilinmeyen bicim: %s\n", argv[i]);
+                    return 2;
+                }
+            } else if (arg.size() > 1 && arg[0] == '-') {
+                std::fprintf(stderr, "Kullanim: --batch [-t N] [--format dmy|iso|long] [dosya ...]\n");
+                return 2;
+            } else {
+                files.push_back(argv[i]);
+            }
+        }
+        if (files.empty()) {
+            files.push_back("-");
+        }
+
+        std::vector<char> out_buffer(1 << 20);
+        std::setvbuf(stdout, out_buffer.data(), _IOFBF, out_buffer.size());
+
+        BatchStats total;
+        for (const char* path : files) {
+            const bool use_stdin = std::strcmp(path, "-") == 0;
+            std::FILE* in = use_stdin ? stdin : std::fopen(path, "rb");
+            if (!in) {
+                std::fprintf(stderr, "Dosya acilamadi: %s\n", path);
+                std::fflush(stdout);
+                return 2;
+            }
+            const BatchStats stats = run_batch(in, stdout, options);
+            total.lines += stats.lines;
+            total.errors += stats.errors;
+            if (!use_stdin) {
+                std::fclose(in);
+            }
+        }
+        std::fflush(stdout);
+        return total.errors == 0 ? 0 : 1;
+    }
+}
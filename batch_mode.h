@@ -0,0 +1,42 @@
+#ifndef BATCH_MODE_H
+#define BATCH_MODE_H
+
+#include <cstdint>
+#include <cstdio>
+#include "date_format.h"
+
+// Etkileşimsiz toplu mod: her satır bir komuttur, her komut bir (random
+// için count) çıktı satırı üretir. Alanlar boşluk, sekme ya da virgülle
+// ayrılır; böylece CSV girdisi de doğrudan okunur.
+//
+//   age <dogum> [referans]     -> "yil ay gun" (referans yoksa bugün)
+//   diff <tarih1> <tarih2>     -> tarih2 - tarih1 (gün)
+//   add-days <tarih> <n>       -> tarih + n
+//   leap-check <yil>           -> 1 / 0
+//   weekday <tarih>            -> gün adı
+//   generate-random <n> [tohum]-> n rastgele tarih (n <= 1000000)
+//
+// Kısa adlar: add, leap, random. Hatalı satırlar "ERR <mesaj>" yazar ve
+// işlem devam eder; boş satırlar ve '#' açıklamaları atlanır.
+
+namespace project {
+    struct BatchOptions {
+        unsigned threads = 1;                      // 0: donanım iş parçacığı sayısı
+        DateFormat format = DateFormat::dmy;
+        std::size_t block_bytes = 4 << 20;        // tek seferde okunan girdi
+    };
+
+    struct BatchStats {
+        std::uint64_t lines = 0;
+        std::uint64_t errors = 0;
+    };
+
+    // in'den komutları okur, sonuçları out'a girdi sırasıyla yazar.
+    BatchStats run_batch(std::FILE* in, std::FILE* out, const BatchOptions& options = {});
+
+    // Komut satırı: [-t N] [--format dmy|iso|long] [dosya ...]; dosya
+    // verilmezse ya da "-" ise stdin okunur. Çıkış kodu döndürür.
+    int run_batch_main(int argc, char* argv[]);
+}
+
+#endif
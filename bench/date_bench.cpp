@@ -0,0 +1,337 @@
+// Date kütüphanesi için mikro ve uçtan uca ölçümler.
+//
+// Derleme (depo kökünden):
+//   g++ -std=c++17 -O2 -I. bench/date_bench.cpp date.cpp date_parse.cpp date_format.cpp serial_date.cpp date_metrics.cpp date_random.cpp date_clock.cpp -o date_bench
+// Kullanım:
+//   ./date_bench [--rows N] [--filter metin] [--json] [--label etiket]
+//
+// --json her sonuç için bir JSON satırı yazar; farklı commit'lerin
+// çıktıları satır satır karşılaştırılabilir. ns/op yanında işlem başına
+// bellek ayırma sayısı ve bayt miktarı raporlanır.
+
+#include "date.h"
+#include "date_format.h"
+#include "date_parse.h"
+#include "serial_date.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace project;
+
+// Allocation counting
+namespace {
+    std::atomic<std::size_t> g_alloc_count{ 0 };
+    std::atomic<std::size_t> g_alloc_bytes{ 0 };
+}
+
+void* operator new(std::size_t size) {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    g_alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+    struct Options {
+        std::size_t rows = 10'000'000;
+        std::string filter;
+        std::string label = "local";
+        bool json = false;
+    };
+
+    struct Result {
+        std::string name;
+        std::string dist;
+        std::size_t ops;
+        double ns_per_op;
+        double allocs_per_op;
+        double bytes_per_op;
+    };
+
+    template<typename T>
+    inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const T* sink;
+        sink = &value;
+#endif
+    }
+
+    class Bench {
+    public:
+        explicit Bench(const Options& options) : m_options(options) {}
+
+        // f(), ops adet işlem yapar. Kısa işlemler en az ~100 ms ölçülene
+        // kadar tekrarlanır.
+        template<typename F>
+        void run(const std::string& name, const std::string& dist, std::size_t ops, F f) {
+            if (!m_options.filter.empty() && (name + "/" + dist).find(m_options.filter) == std::string::npos) {
+                return;
+            }
+
+            f();   // ısınma
+            std::size_t repeats = 0;
+            const std::size_t allocs_before = g_alloc_count.load();
+            const std::size_t bytes_before = g_alloc_bytes.load();
+            const auto start = std::chrono::steady_clock::now();
+            auto now = start;
+            do {
+                f();
+                ++repeats;
+                now = std::chrono::steady_clock::now();
+            } while (now - start < std::chrono::milliseconds(100));
+
+            const double total_ops = static_cast<double>(ops * repeats);
+            Result r{ name, dist, ops * repeats,
+                      std::chrono::duration<double, std::nano>(now - start).count() / total_ops,
+                      static_cast<double>(g_alloc_count.load() - allocs_before) / total_ops,
+                      static_cast<double>(g_alloc_bytes.load() - bytes_before) / total_ops };
+            print(r);
+        }
+
+    private:
+        void print(const Result& r) const {
+            if (m_options.json) {
+                std::printf("{\"label\":\"%s\",\"name\":\"%s\",\"dist\":\"%s\",\"ops\":%zu,"
+                            "\"ns_per_op\":%.3f,\"allocs_per_op\":%.4f,\"bytes_per_op\":%.2f}\n",
+                            m_options.label.c_str(), r.name.c_str(), r.dist.c_str(), r.ops,
+                            r.ns_per_op, r.allocs_per_op, r.bytes_per_op);
+            } else {
+                std::printf("%-28s %-8s %12.2f ns/op %10.4f alloc/op %10.2f B/op\n",
+                            r.name.c_str(), r.dist.c_str(), r.ns_per_op, r.allocs_per_op, r.bytes_per_op);
+            }
+            std::fflush(stdout);
+        }
+
+        const Options& m_options;
+    };
+
+    struct Distribution {
+        const char* name;
+        int first_year;
+        int last_year;
+    };
+
+    constexpr Distribution distributions[] = {
+        { "1900", 1900, 1910 },
+        { "present", 2015, 2035 },
+        { "future", 2900, 3000 },
+    };
+
+    std::vector<Date> make_dates(const Distribution& dist, std::size_t count, unsigned seed) {
+        std::mt19937 eng{ seed };
+        const int first = civil::days_from_civil(1, 1, dist.first_year);
+        const int last = civil::days_from_civil(31, 12, dist.last_year);
+        std::uniform_int_distribution<int> serial{ first, last };
+        std::vector<Date> dates;
+        dates.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            dates.push_back(Date::from_day_serial(serial(eng)));
+        }
+        return dates;
+    }
+
+    std::vector<std::string> to_text(const std::vector<Date>& dates) {
+        std::vector<std::string> text;
+        text.reserve(dates.size());
+        for (const Date& d : dates) {
+            char buf[max_date_chars];
+            text.emplace_back(buf, to_chars(buf, buf + sizeof(buf), d, DateFormat::dmy).ptr);
+        }
+        return text;
+    }
+
+    void micro_benchmarks(Bench& bench) {
+        constexpr std::size_t n = 1 << 16;
+        for (const Distribution& dist : distributions) {
+            const std::vector<Date> dates = make_dates(dist, n, 1);
+            const std::vector<Date> others = make_dates(dist, n, 2);
+            const std::vector<std::string> text = to_text(dates);
+            std::vector<Date> work = dates;
+
+            // -= geri alır ki tarihler tekrarlar boyunca dağılımın içinde kalsın;
+            // her iki geçiş de ölçülür: işlem sayısı 2n
+            bench.run("Date::operator+=/-=", dist.name, 2 * n, [&] {
+                for (Date& d : work) {
+                    d += 17;
+                    do_not_optimize(d);
+                }
+                for (Date& d : work) {
+                    d -= 17;
+                    do_not_optimize(d);
+                }
+            });
+
+            bench.run("operator-(Date,Date)", dist.name, n, [&] {
+                for (std::size_t i = 0; i < n; ++i) {
+                    const int diff = dates[i] - others[i];
+                    do_not_optimize(diff);
+                }
+            });
+
+            bench.run("Date::get_week_day", dist.name, n, [&] {
+                for (const Date& d : dates) {
+                    const Date::Weekday w = d.get_week_day();
+                    do_not_optimize(w);
+                }
+            });
+
+            bench.run("Date(const char*)", dist.name, n, [&] {
+                for (const std::string& s : text) {
+                    const Date d(s.c_str());
+                    do_not_optimize(d);
+                }
+            });
+
+            bench.run("parse_date", dist.name, n, [&] {
+                for (const std::string& s : text) {
+                    Date d;
+                    const DateParseResult r = parse_date(s, d);
+                    do_not_optimize(r);
+                    do_not_optimize(d);
+                }
+            });
+
+            std::ostringstream os;
+            bench.run("operator<<", dist.name, n, [&] {
+                os.str({});
+                for (const Date& d : dates) {
+                    os << d << '\n';
+                }
+            });
+
+            std::vector<char> out(n * (max_date_chars + 1));
+            bench.run("format_dates", dist.name, n, [&] {
+                const FormatDatesResult r = format_dates(out.data(), out.data() + out.size(),
+                                                         dates.data(), dates.size());
+                do_not_optimize(r);
+            });
+        }
+
+        bench.run("Date::random_date", "default", n, [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                const Date d = Date::random_date();
+                do_not_optimize(d);
+            }
+        });
+    }
+
+    // Uçtan uca: "gg/aa/yyyy,gg/aa/yyyy" satırlarından oluşan dosyayı okuyup
+    // her satırın gün farkını hesaplar.
+    void file_benchmark(Bench& bench, std::size_t rows) {
+        const std::string path = "date_bench_input.csv";
+        {
+            const std::vector<Date> a = make_dates(distributions[1], rows, 3);
+            const std::vector<Date> b = make_dates(distributions[1], rows, 4);
+            std::vector<char> out(rows * 2 * (max_date_chars + 1));
+            char* p = out.data();
+            for (std::size_t i = 0; i < rows; ++i) {
+                p = to_chars(p, out.data() + out.size(), a[i], DateFormat::dmy).ptr;
+                *p++ = ',';
+                p = to_chars(p, out.data() + out.size(), b[i], DateFormat::dmy).ptr;
+                *p++ = '\n';
+            }
+            std::ofstream file(path, std::ios::binary);
+            file.write(out.data(), p - out.data());
+        }
+
+        bench.run("file: getline+Date(char*)", "present", rows, [&] {
+            std::ifstream file(path);
+            std::string line;
+            long long sum = 0;
+            while (std::getline(file, line)) {
+                const std::size_t comma = line.find(',');
+                line[comma] = '\0';
+                sum += Date(line.c_str() + comma + 1) - Date(line.c_str());
+            }
+            do_not_optimize(sum);
+        });
+
+        bench.run("file: buffer+parse_date", "present", rows, [&] {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            std::string data(static_cast<std::size_t>(file.tellg()), '\0');
+            file.seekg(0);
+            file.read(data.data(), static_cast<std::streamsize>(data.size()));
+            std::string_view rest = data;
+            long long sum = 0;
+            SerialDate d1, d2;
+            while (!rest.empty()) {
+                const DateParseResult r1 = parse_date(rest, d1);
+                const std::size_t used1 = static_cast<std::size_t>(r1.ptr - rest.data()) + 1;
+                const DateParseResult r2 = parse_date(rest.substr(used1), d2);
+                const std::size_t used2 = static_cast<std::size_t>(r2.ptr - rest.data()) + 1;
+                if (r1.ec != DateErrc::ok || r2.ec != DateErrc::ok) {
+                    break;
+                }
+                sum += d2 - d1;
+                rest.remove_prefix(std::min(used2, rest.size()));
+            }
+            do_not_optimize(sum);
+        });
+
+        std::remove(path.c_str());
+    }
+
+    void sort_benchmark(Bench& bench, std::size_t rows) {
+        const std::vector<Date> dates = make_dates(distributions[1], rows, 5);
+        std::vector<SerialDate> serials(dates.begin(), dates.end());
+
+        bench.run("sort std::vector<Date>", "present", rows, [&] {
+            std::vector<Date> work = dates;
+            std::sort(work.begin(), work.end());
+            do_not_optimize(work.front());
+        });
+
+        bench.run("sort std::vector<SerialDate>", "present", rows, [&] {
+            std::vector<SerialDate> work = serials;
+            std::sort(work.begin(), work.end());
+            do_not_optimize(work.front());
+        });
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--rows" && i + 1 < argc) {
+            options.rows = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--filter" && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if (arg == "--label" && i + 1 < argc) {
+            options.label = argv[++i];
+        } else if (arg == "--json") {
+            options.json = true;
+        } else {
+            std::fprintf(stderr, "Kullanim: %s [--rows N] [--filter metin] [--json] [--label etiket]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    Bench bench{ options };
+    micro_benchmarks(bench);
+    file_benchmark(bench, options.rows);
+    sort_benchmark(bench, options.rows);
+    return 0;
+}
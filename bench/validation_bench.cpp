@@ -0,0 +1,119 @@
+// Geçerli/geçersiz karışık satırlarda istisna fırlatan ve fırlatmayan
+// doğrulama yollarının maliyet karşılaştırması.
+//
+// Derleme (depo kökünden):
+//   g++ -std=c++17 -O2 -I. bench/validation_bench.cpp date.cpp date_parse.cpp date_format.cpp serial_date.cpp date_metrics.cpp date_random.cpp date_clock.cpp -o validation_bench
+// Kullanım:
+//   ./validation_bench [satir_sayisi] [gecersiz_yuzde]
+
+#include "date.h"
+#include "date_parse.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace project;
+
+namespace {
+    struct Row {
+        int day;
+        int month;
+        int year;
+        std::string text;
+    };
+
+    std::vector<Row> make_rows(std::size_t count, int invalid_percent) {
+        std::mt19937 eng{ 12345 };
+        std::uniform_int_distribution<int> percent{ 0, 99 };
+        std::uniform_int_distribution<int> kind{ 0, 3 };
+        std::uniform_int_distribution<int> year_dist{ 1950, 2030 };
+        std::uniform_int_distribution<int> month_dist{ 1, 12 };
+        std::uniform_int_distribution<int> day_dist{ 1, 28 };
+
+        std::vector<Row> rows;
+        rows.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            Row r{ day_dist(eng), month_dist(eng), year_dist(eng), {} };
+            if (percent(eng) < invalid_percent) {
+                switch (kind(eng)) {
+                    case 0: r.day = 31; r.month = 2; break;   // geçersiz gün
+                    case 1: r.month = 13; break;              // geçersiz ay
+                    case 2: r.year = 1850; break;             // geçersiz yıl
+                    default: r.text = "15/xx/2000"; break;    // biçim hatası
+                }
+            }
+            if (r.text.empty()) {
+                char buf[16];
+                std::snprintf(buf, sizeof(buf), "%02d/%02d/%04d", r.day, r.month, r.year);
+                r.text = buf;
+            }
+            rows.push_back(std::move(r));
+        }
+        return rows;
+    }
+
+    template<typename F>
+    void run(const char* name, const std::vector<Row>& rows, F f) {
+        const auto start = std::chrono::steady_clock::now();
+        long long checksum = 0;
+        std::size_t valid = 0;
+        for (const Row& r : rows) {
+            valid += f(r, checksum);
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+        std::printf("%-28s %10.2f ns/row  valid=%zu  checksum=%lld\n",
+                    name, ns / static_cast<double>(rows.size()), valid, checksum);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    const int invalid_percent = argc > 2 ? std::atoi(argv[2]) : 3;
+    const std::vector<Row> rows = make_rows(count, invalid_percent);
+
+    std::printf("rows=%zu invalid=%d%%\n", count, invalid_percent);
+
+    run("Date(d, m, y) + catch", rows, [](const Row& r, long long& sum) {
+        try {
+            const Date date(r.day, r.month, r.year);
+            sum += date.get_day_serial();
+            return 1;
+        } catch (const DateException&) {
+            return 0;
+        }
+    });
+
+    run("Date::try_make", rows, [](const Row& r, long long& sum) {
+        const DateResult date = Date::try_make(r.day, r.month, r.year);
+        if (!date) {
+            return 0;
+        }
+        sum += date->get_day_serial();
+        return 1;
+    });
+
+    run("Date(const char*) + catch", rows, [](const Row& r, long long& sum) {
+        try {
+            const Date date(r.text.c_str());
+            sum += date.get_day_serial();
+            return 1;
+        } catch (const DateException&) {
+            return 0;
+        }
+    });
+
+    run("try_parse_date", rows, [](const Row& r, long long& sum) {
+        const DateResult date = try_parse_date(r.text);
+        if (!date) {
+            return 0;
+        }
+        sum += date->get_day_serial();
+        return 1;
+    });
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+// Toplu çekirdeklerin (date_batch.h) SIMD yollarının skaler yolla birebir
+// karşılaştırması. [ilk, son] aralığındaki her seri numarası bloklar halinde
+// her çekirdekten geçirilir; SSE4.1 ve AVX2 çıktıları skaler çıktıyla aynı
+// olmalıdır. Varsayılan aralık 01/01/-999999 - 31/12/999999 arasındaki tüm
+// günleri kapsar (Date::max_year'a kadar tüm geçerli tarihler dahil).
+//
+// Derleme (depo kökünden):
+//   g++ -std=c++17 -O2 -I. check/date_batch_check.cpp date_batch.cpp -o date_batch_check
+// Kullanım:
+//   ./date_batch_check [ilk_seri son_seri]
+// Uyuşmazlık yoksa 0 ile çıkar.
+
+#include "date_batch.h"
+#include "date_civil.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace project;
+
+namespace {
+    constexpr std::size_t block_rows = 1 << 16;
+
+    // run(out) çekirdeği etkin düzeyde çalıştırır; her SIMD düzeyinin
+    // çıktısı skaler çıktıyla karşılaştırılır.
+    template <typename T, typename Run>
+    long compare(const char* name, std::size_t count, Run run, const std::vector<simd::Level>& levels) {
+        static std::vector<T> expected;
+        static std::vector<T> actual;
+        expected.assign(count, T{});
+        simd::limit_level(simd::Level::scalar);
+        run(expected.data());
+
+        long mismatches = 0;
+        for (const simd::Level level : levels) {
+            actual.assign(count, T{});
+            simd::limit_level(level);
+            run(actual.data());
+            if (std::memcmp(expected.data(), actual.data(), count * sizeof(T)) != 0) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    if (!(expected[i] == actual[i])) {
+                        if (mismatches < 10) {
+                            std::printf("  %s duzey=%d satir=%zu: %lld, beklenen %lld\n", name, static_cast<int>(level), i,
+                                        static_cast<long long>(actual[i]), static_cast<long long>(expected[i]));
+                        }
+                        ++mismatches;
+                    }
+                }
+            }
+        }
+        return mismatches;
+    }
+
+    long check_block(const std::int32_t* serials, std::size_t count, const std::vector<simd::Level>& levels) {
+        static std::vector<std::int32_t> steps;
+        static std::vector<std::int32_t> days;
+        static std::vector<std::int32_t> months;
+        static std::vector<std::int32_t> years;
+        steps.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            steps[i] = static_cast<std::int32_t>(i * 7919 % 20001) - 10000;
+        }
+        days.resize(count);
+        months.resize(count);
+        years.resize(count);
+        simd::limit_level(simd::Level::scalar);
+        batch::from_serials(serials, days.data(), months.data(), years.data(), count);
+
+        long m = 0;
+        m += compare<std::int32_t>("add_days", count, [&](std::int32_t* out) {
+            batch::add_days(serials, 12345, out, count);
+        }, levels);
+        m += compare<std::int32_t>("add_days[]", count, [&](std::int32_t* out) {
+            batch::add_days(serials, steps.data(), out, count);
+        }, levels);
+        m += compare<std::int32_t>("diff_days", count, [&](std::int32_t* out) {
+            batch::diff_days(serials, steps.data(), out, count);
+        }, levels);
+        m += compare<std::uint8_t>("week_days", count, [&](std::uint8_t* out) {
+            batch::week_days(serials, out, count);
+        }, levels);
+        m += compare<std::uint16_t>("year_days", count, [&](std::uint16_t* out) {
+            batch::year_days(serials, out, count);
+        }, levels);
+        m += compare<std::uint8_t>("leap_flags", count, [&](std::uint8_t* out) {
+            batch::leap_flags(serials, out, count);
+        }, levels);
+        m += compare<std::uint8_t>("leap_flags_from_years", count, [&](std::uint8_t* out) {
+            batch::leap_flags_from_years(serials, out, count);
+        }, levels);
+        m += compare<std::int32_t>("from_serials.day", count, [&](std::int32_t* out) {
+            std::vector<std::int32_t> other(count);
+            batch::from_serials(serials, out, other.data(), other.data(), count);
+        }, levels);
+        m += compare<std::int32_t>("from_serials.month", count, [&](std::int32_t* out) {
+            std::vector<std::int32_t> d(count), y(count);
+            batch::from_serials(serials, d.data(), out, y.data(), count);
+        }, levels);
+        m += compare<std::int32_t>("from_serials.year", count, [&](std::int32_t* out) {
+            std::vector<std::int32_t> d(count), mo(count);
+            batch::from_serials(serials, d.data(), mo.data(), out, count);
+        }, levels);
+        m += compare<std::int32_t>("to_serials", count, [&](std::int32_t* out) {
+            batch::to_serials(days.data(), months.data(), years.data(), out, count);
+        }, levels);
+        m += compare<std::uint8_t>("iso_weeks", count, [&](std::uint8_t* out) {
+            batch::iso_weeks(serials, out, count);
+        }, levels);
+        m += compare<std::uint8_t>("quarters", count, [&](std::uint8_t* out) {
+            batch::quarters(serials, out, count);
+        }, levels);
+        for (const int first_month : { 1, 4, 10 }) {
+            m += compare<std::int32_t>("calendar_columns.iso_year", count, [&](std::int32_t* out) {
+                batch::CalendarColumns columns;
+                columns.iso_year = out;
+                batch::calendar_columns(serials, columns, count, first_month);
+            }, levels);
+            m += compare<std::int32_t>("calendar_columns.fiscal_year", count, [&](std::int32_t* out) {
+                batch::CalendarColumns columns;
+                columns.fiscal_year = out;
+                batch::calendar_columns(serials, columns, count, first_month);
+            }, levels);
+            m += compare<std::uint8_t>("calendar_columns.fiscal_period", count, [&](std::uint8_t* out) {
+                batch::CalendarColumns columns;
+                columns.fiscal_period = out;
+                batch::calendar_columns(serials, columns, count, first_month);
+            }, levels);
+        }
+        for (const batch::Bucket bucket : { batch::Bucket::weekday, batch::Bucket::month, batch::Bucket::quarter,
+                                            batch::Bucket::iso_week, batch::Bucket::year_day, batch::Bucket::year }) {
+            m += compare<std::uint16_t>("bucket_ids", count, [&](std::uint16_t* out) {
+                batch::bucket_ids(serials, out, count, bucket);
+            }, levels);
+        }
+
+        // Skaler yolun kendisi: to_serials(from_serials(x)) == x
+        simd::limit_level(simd::Level::scalar);
+        std::vector<std::int32_t> round_trip(count);
+        batch::to_serials(days.data(), months.data(), years.data(), round_trip.data(), count);
+        m += !std::equal(round_trip.begin(), round_trip.end(), serials);
+        return m;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    long long first = civil::days_from_civil(1, 1, -999'999);
+    long long last = civil::days_from_civil(31, 12, 999'999);
+    if (argc == 3) {
+        first = std::atoll(argv[1]);
+        last = std::atoll(argv[2]);
+    } else if (argc != 1) {
+        std::fprintf(stderr, "Kullanim: %s [ilk_seri son_seri]\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<simd::Level> levels;
+    for (const simd::Level level : { simd::Level::sse41, simd::Level::avx2 }) {
+        if (static_cast<int>(level) <= static_cast<int>(simd::cpu_level())) {
+            levels.push_back(level);
+        }
+    }
+    if (levels.empty()) {
+        std::printf("SIMD yolu yok; karsilastirilacak bir sey yok\n");
+        return 0;
+    }
+
+    std::vector<std::int32_t> serials(block_rows);
+    long mismatches = 0;
+    long long rows = 0;
+    for (long long start = first; start <= last; start += block_rows) {
+        const std::size_t count = static_cast<std::size_t>(std::min<long long>(block_rows, last - start + 1));
+        for (std::size_t i = 0; i < count; ++i) {
+            serials[i] = static_cast<std::int32_t>(start + static_cast<long long>(i));
+        }
+        mismatches += check_block(serials.data(), count, levels);
+        rows += static_cast<long long>(count);
+    }
+
+    std::printf("seri=[%lld, %lld] satir=%lld duzey_sayisi=%zu uyusmazlik=%ld\n", first, last, rows, levels.size(),
+                mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
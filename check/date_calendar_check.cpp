@@ -0,0 +1,172 @@
+// BusinessCalendar'ın gün gün yürüyen bir başvuru uygulamasıyla çapraz
+// denetimi. Rastgele tatiller (add_holiday, add_holidays, load_holidays)
+// ve farklı hafta sonu maskeleriyle is_business_day, business_days_between
+// ve add_business_days aynı sonucu vermeli; pencere dışı sorgular ve
+// geçersiz yıl aralıkları DateException fırlatmalıdır.
+//
+// Derleme (depo kökünden):
+//   g++ -std=c++17 -O2 -I. check/date_calendar_check.cpp date_calendar.cpp date.cpp date_parse.cpp date_format.cpp serial_date.cpp date_metrics.cpp date_random.cpp date_clock.cpp -o date_calendar_check
+// Kullanım:
+//   ./date_calendar_check [sorgu_sayisi]
+// Uyuşmazlık yoksa 0 ile çıkar.
+
+#include "date_calendar.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace project;
+
+namespace {
+    // Başvuru: pencerenin her günü için iş günü bayrağı, sorgular döngüyle
+    struct Reference {
+        int first;
+        std::vector<bool> business;
+
+        int between(int from, int to) const {
+            const int sign = to < from ? -1 : 1;
+            int lo = std::min(from, to) - first;
+            const int hi = std::max(from, to) - first;
+            int n = 0;
+            for (; lo < hi; ++lo) {
+                n += business[static_cast<std::size_t>(lo)];
+            }
+            return sign * n;
+        }
+
+        // Pencere dışına çıkarsa false
+        bool add(int serial, int n, int& result) const {
+            int index = serial - first;
+            const int step = n < 0 ? -1 : 1;
+            for (int left = n < 0 ? -n : n; left > 0;) {
+                index += step;
+                if (index < 0 || index >= static_cast<int>(business.size())) {
+                    return false;
+                }
+                left -= business[static_cast<std::size_t>(index)];
+            }
+            result = first + index;
+            return true;
+        }
+    };
+
+    template <typename F>
+    bool throws(F f) {
+        try {
+            f();
+        } catch (const DateException&) {
+            return true;
+        }
+        return false;
+    }
+
+    long check_calendar(std::mt19937& eng, int first_year, int last_year, WeekendMask weekend,
+                        std::size_t queries) {
+        BusinessCalendar calendar(first_year, last_year, weekend);
+        Reference ref{ civil::days_from_civil(1, 1, first_year), {} };
+        const int days = civil::days_from_civil(31, 12, last_year) + 1 - ref.first;
+        for (int i = 0; i < days; ++i) {
+            ref.business.push_back(!weekend.contains(static_cast<Date::Weekday>((ref.first + i) % 7)));
+        }
+
+        // Tatiller üç yoldan; pencere dışındakiler yok sayılır (1900'den
+        // önceki günler Date olamaz)
+        const auto random_date = [&](int margin) {
+            margin = first_year > Date::year_base ? margin : 0;
+            return Date::from_day_serial(ref.first - margin +
+                                         static_cast<int>(eng() % static_cast<unsigned>(days + 2 * margin)));
+        };
+        const auto mark = [&](const Date& date) {
+            const int index = date.get_day_serial() - ref.first;
+            if (index >= 0 && index < days) {
+                ref.business[static_cast<std::size_t>(index)] = false;
+            }
+        };
+        for (int i = 0; i < 20; ++i) {
+            const Date date = random_date(30);
+            calendar.add_holiday(date);
+            mark(date);
+        }
+        std::vector<Date> batch;
+        for (int i = 0; i < days / 20; ++i) {
+            batch.push_back(random_date(30));
+            mark(batch.back());
+        }
+        calendar.add_holidays(batch.data(), batch.size());
+
+        const std::string path = "/tmp/date_calendar_check." + std::to_string(::getpid()) + ".txt";
+        {
+            std::ofstream out(path);
+            out << "# tatiller\n\n";
+            for (int i = 0; i < 50; ++i) {
+                const Date date = random_date(0);
+                mark(date);
+                out << "  " << date.get_month_day() << '/' << date.get_month() << '/' << date.get_year()
+                    << (i % 2 ? " # aciklama\r\n" : "\n");
+            }
+        }
+        (void)calendar.load_holidays(path);
+        std::remove(path.c_str());
+
+        long mismatches = 0;
+        int total = 0;
+        for (int i = 0; i < days; ++i) {
+            const bool business = ref.business[static_cast<std::size_t>(i)];
+            mismatches += calendar.is_business_day(SerialDate::from_serial(ref.first + i)) != business;
+            total += business;
+        }
+        mismatches += calendar.business_day_count() != total;
+
+        for (std::size_t q = 0; q < queries; ++q) {
+            // Uç nokta olarak pencerenin bir gün sonrası da geçerlidir
+            const int from = ref.first + static_cast<int>(eng() % static_cast<unsigned>(days + 1));
+            const int to = ref.first + static_cast<int>(eng() % static_cast<unsigned>(days + 1));
+            mismatches += calendar.business_days_between(SerialDate::from_serial(from), SerialDate::from_serial(to)) !=
+                          ref.between(from, to);
+
+            const int start = ref.first + static_cast<int>(eng() % static_cast<unsigned>(days));
+            const int n = static_cast<int>(eng() % 801) - 400;
+            int expected = 0;
+            if (ref.add(start, n, expected)) {
+                mismatches += calendar.add_business_days(SerialDate::from_serial(start), n).serial() != expected;
+            } else {
+                mismatches += !throws([&] { (void)calendar.add_business_days(SerialDate::from_serial(start), n); });
+            }
+        }
+
+        // Pencere dışı
+        const SerialDate before = SerialDate::from_serial(ref.first - 1);
+        const SerialDate after = SerialDate::from_serial(ref.first + days);
+        mismatches += !throws([&] { (void)calendar.is_business_day(before); });
+        mismatches += !throws([&] { (void)calendar.is_business_day(after); });
+        mismatches += !throws([&] { (void)calendar.add_business_days(after, 1); });
+        mismatches += !throws([&] { (void)calendar.business_days_between(before, after); });
+        return mismatches;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t queries = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20'000;
+    std::mt19937 eng{ 20220101 };
+    long mismatches = 0;
+
+    const WeekendMask friday_saturday{ Date::Weekday::Friday, Date::Weekday::Saturday };
+    mismatches += check_calendar(eng, 1900, 1900, saturday_sunday, queries);
+    mismatches += check_calendar(eng, 2000, 2030, saturday_sunday, queries);
+    mismatches += check_calendar(eng, 2000, 2030, friday_saturday, queries);
+    mismatches += check_calendar(eng, 1999, 2001, WeekendMask{}, queries);
+
+    // Geçersiz yıl aralıkları
+    mismatches += !throws([] { BusinessCalendar(1899, 2000); });
+    mismatches += !throws([] { BusinessCalendar(2000, 1999); });
+    mismatches += !throws([] { BusinessCalendar(1900, Date::max_year + 1); });
+    mismatches += !throws([] { BusinessCalendar(1900, 2'000'000'000); });
+
+    std::printf("BusinessCalendar  sorgu=%zu uyusmazlik=%ld\n", queries, mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
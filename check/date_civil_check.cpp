@@ -0,0 +1,76 @@
+// Gün seri numarası motorunun (date_civil.h) eski döngülü uygulamayla
+// kapsamlı karşılaştırması. 01/01/0001 - 31/12/Date::max_year arasındaki
+// her gün sırayla yürünür; her gün için days_from_civil, formül yolu,
+// year_day ve civil_from_days eski hesapla aynı olmalıdır.
+//
+// Derleme (depo kökünden):
+//   g++ -std=c++17 -O2 -I. check/date_civil_check.cpp -o date_civil_check
+// Kullanım:
+//   ./date_civil_check [son_yil]
+// Uyuşmazlık yoksa 0 ile çıkar.
+
+#include "date.h"
+#include <cstdio>
+#include <cstdlib>
+
+using namespace project;
+
+namespace {
+    // Eski motor: yıl başı kapalı formülü, ay günleri döngüyle toplanır
+    bool old_isleap(int y) {
+        return (y % 4 == 0 && y % 100 != 0) || (y % 400 == 0);
+    }
+
+    int old_days_in_month(int month, int year) {
+        static const int days[2][12] = {
+            { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 },
+            { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 }
+        };
+        return days[old_isleap(year)][month - 1];
+    }
+
+    int old_date_to_days(int day, int month, int year) {
+        const int y = year - 1;
+        int total = y * 365 + y / 4 - y / 100 + y / 400;
+        for (int m = 1; m < month; ++m) {
+            total += old_days_in_month(m, year);
+        }
+        return total + day;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const int last_year = argc > 1 ? std::atoi(argv[1]) : Date::max_year;
+
+    // Eski days_to_date yılları ve ayları tek tek sayardı; burada aynı
+    // sayım artımlı yapılır: serial her gün bir artar.
+    long long checked = 0;
+    long mismatches = 0;
+    int serial = 1;
+    for (int year = 1; year <= last_year; ++year) {
+        int year_day = 0;
+        for (int month = 1; month <= 12; ++month) {
+            const int length = old_days_in_month(month, year);
+            for (int day = 1; day <= length; ++day, ++serial) {
+                ++year_day;
+                const civil::CivilDate c = civil::civil_from_days(serial);
+                const bool ok = civil::days_from_civil(day, month, year) == serial &&
+                                civil::days_from_civil_formula(day, month, year) == serial &&
+                                old_date_to_days(day, month, year) == serial &&
+                                civil::year_day(day, month, year) == year_day &&
+                                c.day == day && c.month == month && c.year == year &&
+                                civil::days_in_month(month, year) == length;
+                if (!ok) {
+                    if (mismatches < 10) {
+                        std::printf("  %02d/%02d/%d (seri %d)\n", day, month, year, serial);
+                    }
+                    ++mismatches;
+                }
+                ++checked;
+            }
+        }
+    }
+
+    std::printf("gun=%lld uyusmazlik=%ld\n", checked, mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
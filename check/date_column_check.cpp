@@ -0,0 +1,195 @@
+// Tarih sütunu dosya biçiminin (date_column.h) gidiş-dönüş denetimi.
+// Dar (tek gün, birkaç gün), geniş (yıllara yayılan) ve int32 uçlarını
+// içeren (32 bit genişlik) bloklar karışık yazılır; read_all, decode_block
+// ve select yazılan değerleri satır sırasıyla aynen geri vermelidir. Bozuk
+// başlıklar açılışta reddedilmeli, geçersiz blok boyutu var olan dosyaya
+// dokunmamalıdır.
+//
+// Derleme (depo kökünden):
+//   g++ -std=c++17 -O2 -I. check/date_column_check.cpp date_column.cpp date_mmap.cpp date.cpp date_parse.cpp date_format.cpp serial_date.cpp date_metrics.cpp date_random.cpp date_clock.cpp -pthread -o date_column_check
+// Kullanım:
+//   ./date_column_check [satir_sayisi]
+// Uyuşmazlık yoksa 0 ile çıkar.
+
+#include "date_column.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace project;
+
+namespace {
+    constexpr std::int32_t int_min = std::numeric_limits<std::int32_t>::min();
+    constexpr std::int32_t int_max = std::numeric_limits<std::int32_t>::max();
+
+    // Blok blok değişen genişlikte değerler
+    std::vector<SerialDate> make_column(std::mt19937& eng, std::size_t count) {
+        std::vector<SerialDate> dates(count);
+        std::size_t i = 0;
+        while (i < count) {
+            const std::size_t run = std::min<std::size_t>(count - i, 1 + eng() % 10'000);
+            const std::int32_t base = 693'596 + static_cast<std::int32_t>(eng() % 100'000);
+            const unsigned shape = eng() % 5;
+            for (std::size_t k = 0; k < run; ++k, ++i) {
+                std::int32_t serial = base;
+                switch (shape) {
+                    case 0:  break;                                                                 // genişlik 0
+                    case 1:  serial += static_cast<std::int32_t>(eng() % 8); break;                 // dar
+                    case 2:  serial += static_cast<std::int32_t>(k); break;                        // artan
+                    case 3:  serial += static_cast<std::int32_t>(eng() % 200'000); break;          // geniş
+                    default: serial = static_cast<std::int32_t>(eng()); break;                     // 32 bit
+                }
+                dates[i] = SerialDate::from_serial(serial);
+            }
+        }
+        if (count >= 2) {
+            dates[eng() % count] = SerialDate::from_serial(int_min);
+            dates[eng() % count] = SerialDate::from_serial(int_max);
+        }
+        return dates;
+    }
+
+    long round_trip(std::mt19937& eng, const std::string& path, std::size_t count, std::uint32_t block_rows) {
+        const std::vector<SerialDate> dates = make_column(eng, count);
+        {
+            DateColumnWriter writer(path, block_rows);
+            // Tek tek ve toplu ekleme karışık
+            const std::size_t half = count / 3;
+            for (std::size_t i = 0; i < half; ++i) {
+                writer.append(dates[i]);
+            }
+            writer.append(dates.data() + half, count - half);
+            writer.close();
+        }
+
+        const DateColumnReader reader(path);
+        long mismatches = reader.rows() != count;
+        mismatches += reader.block_count() != (count + block_rows - 1) / block_rows;
+
+        std::vector<SerialDate> out(count);
+        reader.read_all(out.data(), 4);
+        mismatches += !std::equal(out.begin(), out.end(), dates.begin());
+
+        std::fill(out.begin(), out.end(), SerialDate::from_serial(0));
+        std::size_t row = 0;
+        for (std::size_t b = 0; b < reader.block_count(); ++b) {
+            const DateColumnReader::BlockInfo info = reader.block(b);
+            mismatches += info.first_row != row;
+            const std::size_t n = reader.decode_block(b, out.data() + row);
+            mismatches += n != info.rows;
+            const auto range = std::minmax_element(dates.begin() + static_cast<std::ptrdiff_t>(row),
+                                                   dates.begin() + static_cast<std::ptrdiff_t>(row + n));
+            mismatches += info.min != *range.first || info.max != *range.second;
+            row += n;
+        }
+        mismatches += row != count || !std::equal(out.begin(), out.end(), dates.begin());
+
+        for (int q = 0; q < 20 && count != 0; ++q) {
+            SerialDate first = dates[eng() % count];
+            SerialDate last = dates[eng() % count];
+            if (last < first) {
+                std::swap(first, last);
+            }
+            std::vector<SerialDate> expected;
+            std::copy_if(dates.begin(), dates.end(), std::back_inserter(expected),
+                         [&](SerialDate s) { return s >= first && s < last; });
+            const std::size_t n = reader.select(first, last, out.data());
+            mismatches += n != expected.size() || !std::equal(expected.begin(), expected.end(), out.begin());
+        }
+        return mismatches;
+    }
+
+    std::vector<char> read_file(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    void write_file(const std::string& path, const std::vector<char>& bytes) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    bool rejected(const std::string& path) {
+        try {
+            const DateColumnReader reader(path);
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    }
+
+    long check_corrupt(std::mt19937& eng, const std::string& path) {
+        const std::vector<SerialDate> dates = make_column(eng, 10'000);
+        {
+            DateColumnWriter writer(path, 1000);
+            writer.append(dates.data(), dates.size());
+        }
+        const std::vector<char> good = read_file(path);
+        column::FileHeader header;
+        std::memcpy(&header, good.data(), sizeof(header));
+
+        long mismatches = 0;
+        // Geçersiz blok boyutu dosyayı silmez
+        try {
+            DateColumnWriter writer(path, 0);
+            ++mismatches;
+        } catch (const std::invalid_argument&) {
+        }
+        mismatches += read_file(path) != good;
+
+        const auto corrupt_block = [&](auto mutate) {
+            std::vector<char> bytes = good;
+            column::BlockHeader block;
+            std::memcpy(&block, bytes.data() + header.directory_offset, sizeof(block));
+            mutate(block);
+            std::memcpy(bytes.data() + header.directory_offset, &block, sizeof(block));
+            write_file(path, bytes);
+            return rejected(path);
+        };
+        mismatches += !corrupt_block([](column::BlockHeader& b) { b.offset = ~std::uint64_t{ 0 } - 3; });
+        mismatches += !corrupt_block([](column::BlockHeader& b) { b.offset = 0; });
+        mismatches += !corrupt_block([](column::BlockHeader& b) { b.width = 33; });
+        mismatches += !corrupt_block([](column::BlockHeader& b) { b.width = 0x80000000u; });
+        mismatches += !corrupt_block([](column::BlockHeader& b) { b.min = b.max + 1; });
+        mismatches += !corrupt_block([](column::BlockHeader& b) { b.rows += 1; });
+
+        std::vector<char> bytes = good;
+        bytes[0] = 'X';
+        write_file(path, bytes);
+        mismatches += !rejected(path);
+        bytes = good;
+        bytes.resize(sizeof(header) - 1);
+        write_file(path, bytes);
+        mismatches += !rejected(path);
+        return mismatches;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t rows = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'200'000;
+    const std::string path = "/tmp/date_column_check." + std::to_string(::getpid()) + ".dtc";
+    std::mt19937 eng{ 20210315 };
+    long mismatches = 0;
+
+    for (const std::uint32_t block_rows : { 1u, 7u, 64u, column::default_block_rows }) {
+        for (const std::size_t count : { std::size_t{ 0 }, std::size_t{ 1 }, std::size_t{ 2 },
+                                         static_cast<std::size_t>(block_rows), std::size_t{ 5000 } }) {
+            mismatches += round_trip(eng, path, count, block_rows);
+        }
+    }
+    mismatches += round_trip(eng, path, rows, column::default_block_rows);
+    const long corrupt = check_corrupt(eng, path);
+    std::remove(path.c_str());
+
+    std::printf("gidis-donus  satir=%zu uyusmazlik=%ld\n", rows, mismatches);
+    std::printf("bozuk dosya  uyusmazlik=%ld\n", corrupt);
+    return mismatches + corrupt == 0 ? 0 : 1;
+}
@@ -0,0 +1,120 @@
+// histogram ve group_by'ın (date_histogram.h) tek tek sayımla çapraz
+// denetimi. Altı bucket türünün her biri, dar (1900-2100) ve geniş
+// (1900-Date::max_year) tarih aralıklarında, birden çok iş parçacığıyla
+// aynı sayıları ve toplamları vermelidir. Toplamlar tamsayı değerli
+// olduğundan sıradan bağımsız olarak birebir karşılaştırılır.
+//
+// Derleme (depo kökünden):
+//   g++ -std=c++17 -O2 -I. check/date_histogram_check.cpp date_histogram.cpp date_batch.cpp date.cpp date_parse.cpp date_format.cpp serial_date.cpp date_metrics.cpp date_random.cpp date_clock.cpp -pthread -o date_histogram_check
+// Kullanım:
+//   ./date_histogram_check [satir_sayisi]
+// Uyuşmazlık yoksa 0 ile çıkar.
+
+#include "date_histogram.h"
+#include "date.h"
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace project;
+
+namespace {
+    int reference_bucket(std::int32_t serial, DateBucket bucket) {
+        const civil::CivilDate c = civil::civil_from_days(serial);
+        switch (bucket) {
+            case DateBucket::weekday:  return (serial % 7 + 7) % 7;
+            case DateBucket::month:    return c.month;
+            case DateBucket::quarter:  return (c.month + 2) / 3;
+            case DateBucket::iso_week: return civil::iso_week(serial).week;
+            case DateBucket::year_day: return civil::year_day(c.day, c.month, c.year);
+            default:                   return c.year;
+        }
+    }
+
+    template <typename Result>
+    long compare(const Result& result, const std::map<int, std::uint64_t>& counts,
+                 const std::map<int, double>* sums, DateBucket bucket) {
+        long mismatches = result.bucket != bucket;
+        std::uint64_t total = 0;
+        for (const auto& [value, n] : counts) {
+            mismatches += result.count(value) != n;
+            total += n;
+        }
+        mismatches += result.total() != total;
+        // Yıl aralığı verinin en küçük ve en büyük yılıdır
+        if (bucket == DateBucket::year && !counts.empty()) {
+            mismatches += result.first != counts.begin()->first;
+            mismatches += result.counts.size() != static_cast<std::size_t>(counts.rbegin()->first - result.first + 1);
+        }
+        if constexpr (std::is_same_v<Result, DateGroups>) {
+            for (const auto& [value, sum] : *sums) {
+                mismatches += result.sum(value) != sum;
+            }
+        }
+        return mismatches;
+    }
+
+    long check(const std::vector<std::int32_t>& serials, const std::vector<double>& values, unsigned threads) {
+        std::vector<SerialDate> dates(serials.size());
+        for (std::size_t i = 0; i < serials.size(); ++i) {
+            dates[i] = SerialDate::from_serial(serials[i]);
+        }
+
+        long mismatches = 0;
+        for (const DateBucket bucket : { DateBucket::weekday, DateBucket::month, DateBucket::quarter,
+                                         DateBucket::iso_week, DateBucket::year_day, DateBucket::year }) {
+            std::map<int, std::uint64_t> counts;
+            std::map<int, double> sums;
+            for (std::size_t i = 0; i < serials.size(); ++i) {
+                const int value = reference_bucket(serials[i], bucket);
+                ++counts[value];
+                sums[value] += values[i];
+            }
+            const long m = compare(histogram(serials.data(), serials.size(), bucket, threads), counts, nullptr, bucket) +
+                           compare(histogram(dates.data(), dates.size(), bucket, threads), counts, nullptr, bucket) +
+                           compare(group_by(serials.data(), values.data(), serials.size(), bucket, threads),
+                                   counts, &sums, bucket) +
+                           compare(group_by(dates.data(), values.data(), dates.size(), bucket, threads),
+                                   counts, &sums, bucket);
+            if (m != 0) {
+                std::printf("  bucket=%d satir=%zu: %ld uyusmazlik\n", static_cast<int>(bucket), serials.size(), m);
+            }
+            mismatches += m;
+        }
+        return mismatches;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t rows = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 400'000;
+    std::mt19937 eng{ 20240901 };
+    long mismatches = 0;
+
+    const int ranges[][2] = { { 1900, 2100 }, { 1900, Date::max_year }, { 65'000, 70'000 } };
+    for (const auto& range : ranges) {
+        const std::int32_t first = civil::days_from_civil(1, 1, range[0]);
+        const std::int32_t last = civil::days_from_civil(31, 12, range[1]);
+        for (const std::size_t count : { std::size_t{ 0 }, std::size_t{ 1 }, std::size_t{ 2049 }, rows }) {
+            std::vector<std::int32_t> serials(count);
+            std::vector<double> values(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                serials[i] = first + static_cast<std::int32_t>(eng() % static_cast<std::uint32_t>(last - first + 1));
+                values[i] = static_cast<double>(eng() % 1000);
+            }
+            for (const unsigned threads : { 1u, 4u }) {
+                mismatches += check(serials, values, threads);
+            }
+        }
+    }
+
+    // 65535'in üstündeki yıllar ayrı bucket'lardır
+    const std::vector<std::int32_t> high = { civil::days_from_civil(1, 1, 70'000),
+                                             civil::days_from_civil(1, 1, Date::max_year) };
+    mismatches += check(high, { 1.0, 2.0 }, 1);
+
+    std::printf("histogram / group_by  uyusmazlik=%ld\n", mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
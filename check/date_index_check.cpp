@@ -0,0 +1,119 @@
+// DateIndex'in std::stable_sort ve std::lower_bound ile çapraz denetimi.
+// Dar aralıklı (dizin yolu) ve geniş aralıklı (ağaç yolu) anahtar kümeleri,
+// int32 uçlarındaki anahtarlar dahil, aynı sıralamayı ve aynı sorgu
+// sonuçlarını vermelidir.
+//
+// Derleme (depo kökünden):
+//   g++ -std=c++17 -O2 -I. check/date_index_check.cpp date_index.cpp date.cpp date_parse.cpp date_format.cpp serial_date.cpp date_metrics.cpp date_random.cpp date_clock.cpp -o date_index_check
+// Kullanım:
+//   ./date_index_check [tur_sayisi]
+// Uyuşmazlık yoksa 0 ile çıkar.
+
+#include "date_index.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace project;
+
+namespace {
+    constexpr std::int32_t int_min = std::numeric_limits<std::int32_t>::min();
+    constexpr std::int32_t int_max = std::numeric_limits<std::int32_t>::max();
+
+    std::vector<std::int32_t> make_keys(std::mt19937& eng, int shape) {
+        const std::size_t count = eng() % 3 == 0 ? eng() % 40 : eng() % 200'000;
+        std::vector<std::int32_t> keys(count);
+        // Pencerenin tabanı: olağan tarihler ya da int32 uçlarının yakını
+        const std::int32_t bases[] = { 693'596, int_min, int_max - 5000, -5000 };
+        const std::int32_t base = bases[eng() % 4];
+        for (std::int32_t& key : keys) {
+            switch (shape) {
+                case 0:   // dar: dizin yolu
+                    key = static_cast<std::int32_t>(static_cast<std::int64_t>(base) + eng() % 5000);
+                    break;
+                case 1:   // geniş: ağaç yolu
+                    key = static_cast<std::int32_t>(eng());
+                    break;
+                default:  // geniş, uçlar ve kümeler karışık
+                    switch (eng() % 4) {
+                        case 0:  key = int_min + static_cast<std::int32_t>(eng() % 3); break;
+                        case 1:  key = int_max - static_cast<std::int32_t>(eng() % 3); break;
+                        default: key = 693'596 + static_cast<std::int32_t>(eng() % 40'000); break;
+                    }
+                    break;
+            }
+        }
+        return keys;
+    }
+
+    long check_round(std::mt19937& eng, int shape) {
+        const std::vector<std::int32_t> keys = make_keys(eng, shape);
+        std::vector<SerialDate> dates(keys.size());
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            dates[i] = SerialDate::from_serial(keys[i]);
+        }
+        const DateIndex index(dates.data(), dates.size());
+
+        // Beklenen: anahtara göre kararlı sıralanmış satır numaraları
+        std::vector<std::uint32_t> order(keys.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            order[i] = static_cast<std::uint32_t>(i);
+        }
+        std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) { return keys[a] < keys[b]; });
+        std::vector<std::int32_t> sorted(keys.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            sorted[i] = keys[order[i]];
+        }
+
+        long mismatches = index.size() != keys.size();
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            mismatches += index.row(i) != order[i] || index.key(i).serial() != sorted[i];
+        }
+
+        std::vector<std::int32_t> queries = { int_min, int_min + 1, int_max - 1, int_max, 0, -1, 693'596 };
+        for (std::size_t i = 0; i < 2000 && !keys.empty(); ++i) {
+            const std::int32_t key = keys[eng() % keys.size()];
+            queries.push_back(key);
+            queries.push_back(key == int_min ? key : key - 1);
+            queries.push_back(key == int_max ? key : key + 1);
+        }
+        for (std::size_t i = 0; i < 2000; ++i) {
+            queries.push_back(static_cast<std::int32_t>(eng()));
+        }
+
+        for (const std::int32_t q : queries) {
+            const SerialDate date = SerialDate::from_serial(q);
+            const std::size_t lower = static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), q) - sorted.begin());
+            const std::size_t upper = static_cast<std::size_t>(std::upper_bound(sorted.begin(), sorted.end(), q) - sorted.begin());
+            const DateIndexSpan equal = index.equal_range(date);
+            mismatches += index.lower_bound(date) != lower;
+            mismatches += index.upper_bound(date) != upper;
+            mismatches += index.predecessor(date) != (lower == 0 ? DateIndex::npos : lower - 1);
+            mismatches += equal.size() != upper - lower;
+            for (std::size_t k = 0; k < equal.size() && k < upper - lower; ++k) {
+                mismatches += equal.rows[k] != order[lower + k] || equal.keys[k].serial() != q;
+            }
+
+            const std::int32_t other = queries[eng() % queries.size()];
+            const std::size_t other_lower =
+                static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), other) - sorted.begin());
+            const DateIndexSpan span = index.range(date, SerialDate::from_serial(other));
+            mismatches += span.size() != (other < q ? 0 : other_lower - lower);
+        }
+        return mismatches;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const int rounds = argc > 1 ? std::atoi(argv[1]) : 300;
+    std::mt19937 eng{ 20160101 };
+    long mismatches = 0;
+    for (int r = 0; r < rounds; ++r) {
+        mismatches += check_round(eng, r % 3);
+    }
+    std::printf("DateIndex  tur=%d uyusmazlik=%ld\n", rounds, mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,231 @@
+// ingest_date_column'ın (date_ingest.h) satır satır sıralı bir başvuru
+// ayrıştırmasıyla çapraz denetimi. Tırnaklı ve boşluklu alanlar, CRLF satır
+// sonları, başlık, boş satırlar, eksik sütunlar ve sonunda satır sonu
+// olmayan girdiler üretilir; parça boyu satırları ve hatalı satırları parça
+// sınırlarına bölecek kadar küçük seçilir. Tarihler, hatalı satırların
+// satır sırası, bayt ofseti ve hata kodu başvuruyla aynı olmalıdır.
+//
+// Derleme (depo kökünden):
+//   g++ -std=c++17 -O2 -I. check/date_ingest_check.cpp date_ingest.cpp date_mmap.cpp date.cpp date_parse.cpp date_format.cpp serial_date.cpp date_metrics.cpp date_random.cpp date_clock.cpp -pthread -o date_ingest_check
+// Kullanım:
+//   ./date_ingest_check [belge_sayisi]
+// Uyuşmazlık yoksa 0 ile çıkar.
+
+#include "date_ingest.h"
+#include "date_parse.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace project;
+
+namespace {
+    struct Expected {
+        std::vector<SerialDate> dates;
+        std::vector<IngestError> errors;
+    };
+
+    DateErrc reference_field(const std::string& field, SerialDate& out) {
+        std::size_t first = 0;
+        std::size_t last = field.size();
+        while (first < last && (field[first] == ' ' || field[first] == '\t' || field[first] == '"')) {
+            ++first;
+        }
+        while (last > first && (field[last - 1] == ' ' || field[last - 1] == '\t' || field[last - 1] == '\r' ||
+                                field[last - 1] == '"')) {
+            --last;
+        }
+        const std::string_view text(field.data() + first, last - first);
+        int day, month, year;
+        const DateParseResult r = scan_date(text, day, month, year);
+        if (r.ec != DateErrc::ok) {
+            return r.ec;
+        }
+        if (r.ptr != text.data() + text.size()) {
+            return DateErrc::invalid_format;
+        }
+        const DateErrc ec = Date::check_date(day, month, year);
+        if (ec == DateErrc::ok) {
+            out = SerialDate::from_serial(civil::days_from_civil(day, month, year));
+        }
+        return ec;
+    }
+
+    // Sıralı başvuru: satırlar tek tek bölünür, alan std::string ile ayrılır
+    Expected reference(const std::string& text, const IngestOptions& options) {
+        Expected expected;
+        std::size_t pos = 0;
+        if (options.header) {
+            const std::size_t nl = text.find('\n');
+            pos = nl == std::string::npos ? text.size() : nl + 1;
+        }
+        while (pos < text.size()) {
+            std::size_t end = text.find('\n', pos);
+            end = end == std::string::npos ? text.size() : end;
+            const std::string line = text.substr(pos, end - pos);
+            if (!line.empty() && line != "\r") {
+                std::vector<std::string> fields(1);
+                for (const char c : line) {
+                    if (c == options.delimiter) {
+                        fields.emplace_back();
+                    } else {
+                        fields.back() += c;
+                    }
+                }
+                SerialDate date;
+                const DateErrc ec = options.column < fields.size() ? reference_field(fields[options.column], date)
+                                                                   : DateErrc::invalid_format;
+                if (ec != DateErrc::ok) {
+                    expected.errors.push_back({ expected.dates.size(), pos, ec });
+                }
+                expected.dates.push_back(date);
+            }
+            pos = end + 1;
+        }
+        return expected;
+    }
+
+    std::string random_date_text(std::mt19937& eng) {
+        static const char* const broken[] = { "", "abc", "15/02", "15/02/1998x", "1 5/02/1998", "15//1998",
+                                              "15/02/", "/02/1998", "15/02/1998/", "--" };
+        const char separators[] = { '/', '-', '.' };
+        const char sep = separators[eng() % 3];
+        int day = 1 + static_cast<int>(eng() % 28);
+        int month = 1 + static_cast<int>(eng() % 12);
+        int year = 1900 + static_cast<int>(eng() % 400);
+        switch (eng() % 12) {
+            case 0:  return broken[eng() % (sizeof(broken) / sizeof(broken[0]))];
+            case 1:  day = 31; month = 4; break;                  // geçersiz gün
+            case 2:  day = 29; month = 2; year = 1900; break;     // artık yıl değil
+            case 3:  month = 13; break;                           // geçersiz ay
+            case 4:  year = 1850; break;                          // geçersiz yıl
+            default: break;
+        }
+        // Yarısı sıfır dolgulu
+        const auto number = [&](int n, std::size_t width) {
+            const std::string s = std::to_string(n);
+            return eng() % 2 ? std::string(width - std::min(width, s.size()), '0') + s : s;
+        };
+        return number(day, 2) + sep + number(month, 2) + sep + std::to_string(year);
+    }
+
+    std::string decorate(std::mt19937& eng, std::string field) {
+        switch (eng() % 6) {
+            case 0:  return '"' + field + '"';
+            case 1:  return "  " + field + "\t";
+            case 2:  return " \"" + field + "\" ";
+            default: return field;
+        }
+    }
+
+    // Rastgele ayraçlı belge; tarih options.column sütunundadır
+    std::string make_document(std::mt19937& eng, std::size_t lines, const IngestOptions& options) {
+        std::string text;
+        const std::string d(1, options.delimiter);
+        if (options.header) {
+            text += "kimlik" + d + "tarih" + d + "\"aciklama\"" + (eng() % 2 ? "\r\n" : "\n");
+        }
+        const std::size_t columns = options.column + 1 + eng() % 3;
+        for (std::size_t i = 0; i < lines; ++i) {
+            switch (eng() % 16) {
+                case 0: text += "\n"; continue;                   // boş satır
+                case 1: text += "\r\n"; continue;                 // CRLF boş satır
+                case 2: text += "   \n"; continue;                // yalnız boşluk: veri satırı
+                default: break;
+            }
+            // Arada eksik sütunlu satırlar
+            const std::size_t present = eng() % 20 == 0 ? eng() % (options.column + 1) : columns;
+            for (std::size_t c = 0; c < present; ++c) {
+                if (c != 0) {
+                    text += d;
+                }
+                text += c == options.column ? decorate(eng, random_date_text(eng))
+                                            : decorate(eng, "alan" + std::to_string(eng() % 1000));
+            }
+            if (i + 1 < lines || eng() % 2) {
+                text += eng() % 3 == 0 ? "\r\n" : "\n";
+            }
+        }
+        return text;
+    }
+
+    long compare(const IngestResult& result, const Expected& expected, std::size_t bytes) {
+        long mismatches = result.dates != expected.dates;
+        mismatches += result.errors.size() != expected.errors.size();
+        for (std::size_t i = 0; i < result.errors.size() && i < expected.errors.size(); ++i) {
+            const IngestError& a = result.errors[i];
+            const IngestError& b = expected.errors[i];
+            mismatches += a.row != b.row || a.offset != b.offset || a.ec != b.ec;
+        }
+        mismatches += result.stats.rows != expected.dates.size();
+        mismatches += result.stats.errors != expected.errors.size();
+        mismatches += result.stats.bytes != bytes;
+        return mismatches;
+    }
+
+    long check(const std::string& text, IngestOptions options) {
+        const Expected expected = reference(text, options);
+        long mismatches = 0;
+        for (const std::size_t chunk_bytes : { std::size_t{ 0 }, std::size_t{ 1 }, std::size_t{ 2 }, std::size_t{ 7 },
+                                               std::size_t{ 16 }, std::size_t{ 61 }, std::size_t{ 1 } << 20 }) {
+            for (const unsigned threads : { 1u, 4u }) {
+                options.chunk_bytes = chunk_bytes;
+                options.threads = threads;
+                const long m = compare(ingest_date_column(text.data(), text.size(), options), expected, text.size());
+                if (m != 0 && mismatches == 0) {
+                    std::printf("  parca=%zu is=%u sutun=%zu baslik=%d: %ld uyusmazlik\n", chunk_bytes, threads,
+                                options.column, options.header, m);
+                }
+                mismatches += m;
+            }
+        }
+        return mismatches;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t documents = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 400;
+    std::mt19937 eng{ 20230612 };
+    long mismatches = 0;
+
+    // Uç durumlar
+    IngestOptions with_header;
+    with_header.header = true;
+    for (const char* text : { "", "\n", "\r\n", "tarih", "tarih\n", "15/02/1998", "\"15/02/1998\"\r\n\r\n31/02/2000",
+                              "\n\n15/02/1998\n\n" }) {
+        mismatches += check(text, IngestOptions{});
+        mismatches += check(text, with_header);
+    }
+
+    for (std::size_t i = 0; i < documents; ++i) {
+        IngestOptions options;
+        options.column = eng() % 3;
+        options.delimiter = eng() % 2 ? ',' : ';';
+        options.header = eng() % 2;
+        mismatches += check(make_document(eng, 1 + eng() % 200, options), options);
+    }
+
+    // Büyük belge dosyadan, varsayılan ve küçük parçalarla
+    IngestOptions options;
+    options.column = 1;
+    options.header = true;
+    const std::string text = make_document(eng, 200'000, options);
+    const std::string path = "/tmp/date_ingest_check." + std::to_string(::getpid()) + ".csv";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << text;
+    }
+    const Expected expected = reference(text, options);
+    mismatches += compare(ingest_date_column(path, options), expected, text.size());
+    options.chunk_bytes = 4096;
+    mismatches += compare(ingest_date_column(path, options), expected, text.size());
+    std::remove(path.c_str());
+
+    std::printf("ingest  belge=%zu uyusmazlik=%ld\n", documents, mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,165 @@
+// Ölçüm katmanının (date_metrics.h) denetimi. PROJECT_DATE_METRICS=1 ile
+// derlenir; bilinen sayıda işlemden sonra sayaçlar ve zamanlayıcı
+// sayıları birebir beklenen değerde olmalı, sonlanan iş parçacıklarının
+// sayımları korunmalı, reset() tabanı sonraki snapshot()'lardan düşmeli ve
+// export_text() Prometheus metin biçimini üretmelidir.
+//
+// Derleme (depo kökünden; tüm çeviri birimleri aynı bayrakla):
+//   g++ -std=c++17 -O2 -DPROJECT_DATE_METRICS=1 -I. check/date_metrics_check.cpp date_metrics.cpp date.cpp date_parse.cpp date_format.cpp serial_date.cpp date_random.cpp date_clock.cpp -pthread -o date_metrics_check
+// Kullanım:
+//   ./date_metrics_check
+// Uyuşmazlık yoksa 0 ile çıkar.
+
+#include "date.h"
+#include "date_format.h"
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !PROJECT_DATE_METRICS
+#error "date_metrics_check PROJECT_DATE_METRICS=1 ile derlenmelidir"
+#endif
+
+using namespace project;
+using metrics::Counter;
+using metrics::Timer;
+
+namespace {
+    long mismatches = 0;
+
+    void expect(const char* what, std::uint64_t actual, std::uint64_t expected) {
+        if (actual != expected) {
+            std::printf("  %s: %llu, beklenen %llu\n", what, static_cast<unsigned long long>(actual),
+                        static_cast<unsigned long long>(expected));
+            ++mismatches;
+        }
+    }
+
+    std::uint64_t counter(const metrics::Snapshot& s, Counter c) {
+        return s.counters[static_cast<int>(c)];
+    }
+
+    const metrics::Histogram& timer(const metrics::Snapshot& s, Timer t) {
+        return s.timers[static_cast<int>(t)];
+    }
+
+    // Derleme zamanında kurulan tarih sayılmaz
+    constexpr Date compile_time_date(1, 1, 2000);
+
+    void run_operations(int rounds) {
+        for (int i = 0; i < rounds; ++i) {
+            Date date(1 + i % 28, 1 + i % 12, 2000 + i % 50);   // construct
+            date += 3;                                          // arithmetic
+            date -= 1;                                          // arithmetic
+            ++date;                                             // arithmetic
+            (void)Date::try_make(31, 2, 2001);                  // validation_failed
+            try {
+                const Date invalid(1, 13, 2000);                // validation_failed
+                (void)invalid;
+            } catch (const InvalidMonthException&) {
+            }
+            const Date parsed("15/02/1998");                    // parse (+ süre)
+            (void)parsed;
+            try {
+                const Date bad("15-xx-1998");                   // parse, parse_failed, format_exception
+                (void)bad;
+            } catch (const InvalidDateFormatException&) {
+            }
+            char buf[32];
+            (void)to_chars(buf, buf + sizeof(buf), date);       // format (+ süre)
+        }
+    }
+
+    void check_counts(const metrics::Snapshot& s, std::uint64_t rounds) {
+        expect("construct", counter(s, Counter::construct), rounds);
+        expect("arithmetic", counter(s, Counter::arithmetic), 3 * rounds);
+        expect("validation_failed", counter(s, Counter::validation_failed), 2 * rounds);
+        expect("parse", counter(s, Counter::parse), 2 * rounds);
+        expect("parse_failed", counter(s, Counter::parse_failed), rounds);
+        expect("format_exception", counter(s, Counter::format_exception), rounds);
+        expect("format", counter(s, Counter::format), rounds);
+        expect("timer parse", timer(s, Timer::parse).count, 2 * rounds);
+        expect("timer format", timer(s, Timer::format).count, rounds);
+        expect("timer stream_out", timer(s, Timer::stream_out).count, 0);
+        for (const metrics::Histogram& h : s.timers) {
+            std::uint64_t n = 0;
+            for (const std::uint64_t b : h.buckets) {
+                n += b;
+            }
+            expect("histogram count", h.count, n);
+        }
+    }
+
+    void check_export(const metrics::Snapshot& s) {
+        const std::string text = metrics::export_text(s);
+        const auto contains = [&](const std::string& line) { return text.find(line + "\n") != std::string::npos; };
+
+        expect("TYPE counter", contains("# TYPE project_date_ops_total counter"), 1);
+        expect("TYPE histogram", contains("# TYPE project_date_latency_ns histogram"), 1);
+        for (int c = 0; c < metrics::counter_count; ++c) {
+            const std::string line = std::string("project_date_ops_total{op=\"") + metrics::name(static_cast<Counter>(c)) +
+                                     "\"} " + std::to_string(s.counters[c]);
+            expect(line.c_str(), contains(line), 1);
+        }
+        for (int t = 0; t < metrics::timer_count; ++t) {
+            const metrics::Histogram& h = s.timers[t];
+            const std::string op = metrics::name(static_cast<Timer>(t));
+            std::uint64_t cumulative = 0;
+            for (int b = 0; b < metrics::histogram_buckets - 1; ++b) {
+                cumulative += h.buckets[b];
+                const std::string line = "project_date_latency_ns_bucket{op=\"" + op + "\",le=\"" +
+                                         std::to_string((1ULL << b) - 1) + "\"} " + std::to_string(cumulative);
+                expect(line.c_str(), contains(line), 1);
+            }
+            const std::string count = std::to_string(h.count);
+            expect("+Inf", contains("project_date_latency_ns_bucket{op=\"" + op + "\",le=\"+Inf\"} " + count), 1);
+            expect("_sum", contains("project_date_latency_ns_sum{op=\"" + op + "\"} " + std::to_string(h.sum_ns)), 1);
+            expect("_count", contains("project_date_latency_ns_count{op=\"" + op + "\"} " + count), 1);
+        }
+    }
+}
+
+int main() {
+    (void)compile_time_date;
+    expect("enabled", metrics::enabled(), 1);
+
+    // Önceki işlemler reset() tabanına girer
+    run_operations(5);
+    metrics::reset();
+    metrics::Snapshot s = metrics::snapshot();
+    for (const std::uint64_t c : s.counters) {
+        expect("reset sonrası sayaç", c, 0);
+    }
+
+    run_operations(100);
+    check_counts(metrics::snapshot(), 100);
+
+    // Sonlanan iş parçacıklarının sayımları snapshot'ta kalır
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] { run_operations(250); });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    s = metrics::snapshot();
+    check_counts(s, 1100);
+    check_export(s);
+
+    // operator<< kendi süresini ve to_chars üzerinden biçimlendirmeyi sayar
+    metrics::reset();
+    std::ostringstream out;
+    out << Date(15, 2, 1998);
+    s = metrics::snapshot();
+    expect("stream_out", timer(s, Timer::stream_out).count, 1);
+    expect("stream format", counter(s, Counter::format), 1);
+    expect("stream text", out.str() == "15 Subat 1998 Pazar", 1);
+
+    metrics::reset();
+    check_export(metrics::snapshot());
+
+    std::printf("metrics  uyusmazlik=%ld\n", mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
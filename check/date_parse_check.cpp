@@ -0,0 +1,215 @@
+// Ayrıştırıcıların bağımsız bir başvuru uygulamasıyla çapraz denetimi:
+// try_parse_date / parse_date rastgele metinlerde, parse_dates_fixed ise
+// 1900-2400 arasındaki tüm günlerde ve bozulmuş kayıtlarda, her SIMD
+// düzeyinde aynı sonucu vermelidir.
+//
+// Derleme (depo kökünden):
+//   g++ -std=c++17 -O2 -I. check/date_parse_check.cpp date.cpp date_parse.cpp date_format.cpp serial_date.cpp date_metrics.cpp date_random.cpp date_clock.cpp -o date_parse_check
+// Kullanım:
+//   ./date_parse_check [rastgele_metin_sayisi]
+// Uyuşmazlık yoksa 0 ile çıkar.
+
+#include "date_parse.h"
+#include "date_simd.h"
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace project;
+
+namespace {
+    // Başvuru: kütüphanenin tablolarını ve formüllerini kullanmaz
+    bool reference_leap(long long y) {
+        return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    }
+
+    long long reference_serial(long long d, long long m, long long y) {
+        static const int before[12] = { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+        const long long p = y - 1;
+        return p * 365 + p / 4 - p / 100 + p / 400 + before[m - 1] + (m > 2 && reference_leap(y)) + d;
+    }
+
+    DateErrc reference_check(long long d, long long m, long long y) {
+        static const int lengths[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+        if (y < Date::year_base || y > Date::max_year) {
+            return DateErrc::invalid_year;
+        }
+        if (m < 1 || m > 12) {
+            return DateErrc::invalid_month;
+        }
+        if (d < 1 || d > lengths[m - 1] + (m == 2 && reference_leap(y))) {
+            return DateErrc::invalid_day;
+        }
+        return DateErrc::ok;
+    }
+
+    // "sayi ayrac sayi ayrac sayi" ve başka hiçbir şey; sayı en fazla 9 hane.
+    // try_parse_date gibi takvim hatası artık karakterlerden önce raporlanır.
+    DateErrc reference_parse(const std::string& text, long long& serial) {
+        long long fields[3];
+        std::size_t i = 0;
+        for (int f = 0; f < 3; ++f) {
+            if (f > 0) {
+                if (i == text.size() || (text[i] != '/' && text[i] != '-' && text[i] != '.')) {
+                    return DateErrc::invalid_format;
+                }
+                ++i;
+            }
+            const std::size_t start = i;
+            fields[f] = 0;
+            while (i < text.size() && text[i] >= '0' && text[i] <= '9') {
+                fields[f] = fields[f] * 10 + (text[i] - '0');
+                ++i;
+            }
+            if (i == start || i - start > 9) {
+                return DateErrc::invalid_format;
+            }
+        }
+        const DateErrc ec = reference_check(fields[0], fields[1], fields[2]);
+        if (ec != DateErrc::ok) {
+            return ec;
+        }
+        if (i != text.size()) {
+            return DateErrc::invalid_format;
+        }
+        serial = reference_serial(fields[0], fields[1], fields[2]);
+        return DateErrc::ok;
+    }
+
+    // Sabit genişlik: rakamlar ve ayraçlar yerinde değilse invalid_format
+    DateErrc reference_parse_fixed(const std::string& text, long long& serial) {
+        for (std::size_t i = 0; i < 10; ++i) {
+            const bool delimiter = text[i] == '/' || text[i] == '-' || text[i] == '.';
+            const bool digit = text[i] >= '0' && text[i] <= '9';
+            if ((i == 2 || i == 5) ? !delimiter : !digit) {
+                return DateErrc::invalid_format;
+            }
+        }
+        return reference_parse(text, serial);
+    }
+
+    std::string random_text(std::mt19937& eng) {
+        static const char alphabet[] = "0123456789/-.0123456789 x";
+        std::string text;
+        switch (eng() % 4) {
+            case 0: {
+                // Biçimce doğru, alanlar rastgele uzunlukta
+                for (int f = 0; f < 3; ++f) {
+                    if (f > 0) {
+                        text += "/-."[eng() % 3];
+                    }
+                    const unsigned digits = 1 + eng() % 11;
+                    for (unsigned k = 0; k < digits; ++k) {
+                        text += static_cast<char>('0' + eng() % 10);
+                    }
+                }
+                break;
+            }
+            case 1: {
+                text = std::to_string(eng() % 33) + '/' + std::to_string(eng() % 14) + '/' +
+                       std::to_string(1890 + eng() % 600);
+                break;
+            }
+            default: {
+                const unsigned length = eng() % 16;
+                for (unsigned k = 0; k < length; ++k) {
+                    text += alphabet[eng() % (sizeof(alphabet) - 1)];
+                }
+                break;
+            }
+        }
+        return text;
+    }
+
+    long check_text(std::size_t count) {
+        std::mt19937 eng{ 19980215 };
+        long mismatches = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::string text = random_text(eng);
+            long long serial = 0;
+            const DateErrc expected = reference_parse(text, serial);
+            const DateResult parsed = try_parse_date(text);
+            if (parsed.error() != expected || (parsed && parsed->get_day_serial() != serial)) {
+                if (mismatches < 10) {
+                    std::printf("  try_parse_date(\"%s\"): %s, beklenen %s\n", text.c_str(),
+                                to_string(parsed.error()), to_string(expected));
+                }
+                ++mismatches;
+            }
+
+            SerialDate date;
+            const DateParseResult r = parse_date(text, date);
+            if ((expected == DateErrc::ok && (r.ec != DateErrc::ok || date.serial() != serial))) {
+                ++mismatches;
+            }
+        }
+        return mismatches;
+    }
+
+    long check_fixed(simd::Level level) {
+        simd::limit_level(level);
+        std::vector<std::string> texts;
+        for (int y = 1900; y <= 2400; ++y) {
+            for (int m = 0; m <= 13; ++m) {
+                for (int d = 0; d <= 32; ++d) {
+                    char buf[48];
+                    std::snprintf(buf, sizeof(buf), "%02d%c%02d%c%04d", d, "/-."[(d + m) % 3], m, "/-."[y % 3], y);
+                    texts.push_back(buf);
+                }
+            }
+        }
+        // Her konumda bir karakteri bozulmuş kayıtlar
+        std::mt19937 eng{ 7 };
+        const std::size_t valid_texts = texts.size();
+        for (std::size_t i = 0; i < 200'000; ++i) {
+            std::string text = texts[eng() % valid_texts];
+            text[eng() % 10] = " x/-.:09\x7f\xb0"[eng() % 10];
+            texts.push_back(text);
+        }
+
+        constexpr std::size_t stride = 12;
+        std::vector<char> buffer(texts.size() * stride, ' ');
+        for (std::size_t i = 0; i < texts.size(); ++i) {
+            texts[i].copy(buffer.data() + i * stride, 10);
+        }
+        std::vector<SerialDate> out(texts.size(), SerialDate::from_serial(-1));
+        std::vector<DateErrc> errors(texts.size());
+        const std::size_t parsed = parse_dates_fixed(buffer.data(), texts.size(), stride, out.data(), errors.data());
+
+        long mismatches = 0;
+        std::size_t expected_parsed = 0;
+        for (std::size_t i = 0; i < texts.size(); ++i) {
+            long long serial = 0;
+            const DateErrc expected = reference_parse_fixed(texts[i], serial);
+            expected_parsed += expected == DateErrc::ok;
+            if (errors[i] != expected || (expected == DateErrc::ok && out[i].serial() != serial) ||
+                (expected != DateErrc::ok && out[i].serial() != -1)) {
+                ++mismatches;
+            }
+        }
+        mismatches += parsed != expected_parsed;
+        return mismatches;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2'000'000;
+    long total = 0;
+
+    const long text = check_text(count);
+    std::printf("try_parse_date / parse_date  metin=%zu uyusmazlik=%ld\n", count, text);
+    total += text;
+
+    const simd::Level available = simd::cpu_level();
+    for (const simd::Level level : { simd::Level::scalar, simd::Level::sse41, simd::Level::avx2 }) {
+        if (static_cast<int>(level) > static_cast<int>(available)) {
+            continue;
+        }
+        const long fixed = check_fixed(level);
+        std::printf("parse_dates_fixed  duzey=%d uyusmazlik=%ld\n", static_cast<int>(level), fixed);
+        total += fixed;
+    }
+    return total == 0 ? 0 : 1;
+}
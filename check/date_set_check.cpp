@@ -0,0 +1,133 @@
+// DateSet'in std::set ile çapraz denetimi. Rastgele ekleme/silme/aralık
+// ekleme dizileri ve küme işlemleri, üç blok gösterimi (array, bitmap, run)
+// ile negatif ve int32 ucuna yakın seri numaraları dahil, aynı elemanları
+// aynı sırayla vermelidir. Aynı küme farklı yollardan kurulsa da eşit
+// karşılaştırılmalıdır.
+//
+// Derleme (depo kökünden):
+//   g++ -std=c++17 -O2 -I. check/date_set_check.cpp date_set.cpp date.cpp date_parse.cpp date_format.cpp serial_date.cpp date_metrics.cpp date_random.cpp date_clock.cpp -o date_set_check
+// Kullanım:
+//   ./date_set_check [tur_sayisi]
+// Uyuşmazlık yoksa 0 ile çıkar.
+
+#include "date_set.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace project;
+
+namespace {
+    constexpr int int_min = std::numeric_limits<int>::min();
+    constexpr int int_max = std::numeric_limits<int>::max();
+
+    long compare(const DateSet& set, const std::set<int>& expected) {
+        long mismatches = set.size() != expected.size();
+        auto it = expected.begin();
+        for (auto date = set.begin(); date != set.end(); ++date, ++it) {
+            if (it == expected.end()) {
+                return mismatches + 1;
+            }
+            mismatches += date.serial_date().serial() != *it;
+        }
+        mismatches += it != expected.end();
+
+        it = expected.begin();
+        set.for_each([&](SerialDate date) {
+            mismatches += it == expected.end() || date.serial() != *it;
+            if (it != expected.end()) {
+                ++it;
+            }
+        });
+        return mismatches;
+    }
+
+    long check_round(std::mt19937& eng) {
+        // Pencerenin tabanı: olağan tarihler, negatif seriler ya da int32 ucu
+        const int bases[] = { 726'833, -40'000, int_max - 7000, int_min };
+        const int base = bases[eng() % 4];
+        const int span = 1 + static_cast<int>(eng() % (eng() % 3 == 0 ? 200 : 6000));
+        const auto pick = [&] { return base + static_cast<int>(eng() % static_cast<unsigned>(span)); };
+
+        DateSet a;
+        std::set<int> expected_a;
+        long mismatches = 0;
+        const unsigned operations = eng() % 600;
+        for (unsigned i = 0; i < operations; ++i) {
+            const int serial = pick();
+            if (eng() % 4 == 0) {
+                mismatches += a.erase(SerialDate::from_serial(serial)) != (expected_a.erase(serial) != 0);
+            } else {
+                mismatches += a.insert(SerialDate::from_serial(serial)) != expected_a.insert(serial).second;
+            }
+        }
+        if (eng() % 2) {
+            // [from, to) ucu int32 aralığında kalır
+            const int from = pick();
+            const int to = static_cast<int>(std::min<long long>(static_cast<long long>(from) + eng() % 1500, int_max));
+            a.insert_range(SerialDate::from_serial(from), SerialDate::from_serial(to));
+            for (int serial = from; serial < to; ++serial) {
+                expected_a.insert(serial);
+            }
+        }
+
+        std::vector<SerialDate> input;
+        std::set<int> expected_b;
+        const unsigned count = eng() % 600;
+        for (unsigned i = 0; i < count; ++i) {
+            const int serial = pick();
+            input.push_back(SerialDate::from_serial(serial));
+            expected_b.insert(serial);
+        }
+        const DateSet b(input.data(), input.size());
+
+        mismatches += compare(a, expected_a) + compare(b, expected_b);
+
+        std::set<int> unite = expected_a;
+        unite.insert(expected_b.begin(), expected_b.end());
+        std::set<int> intersect;
+        std::set<int> subtract;
+        for (const int serial : expected_a) {
+            (expected_b.count(serial) ? intersect : subtract).insert(serial);
+        }
+        const DateSet u = a | b;
+        mismatches += compare(u, unite) + compare(a & b, intersect) + compare(a - b, subtract);
+        mismatches += intersection_size(a, b) != intersect.size();
+
+        // Aynı küme, başka bir yoldan kurulduğunda da eşittir
+        std::vector<SerialDate> sorted;
+        for (const int serial : unite) {
+            sorted.push_back(SerialDate::from_serial(serial));
+        }
+        mismatches += DateSet(sorted.data(), sorted.size()) != u;
+        DateSet c = a;
+        c -= b;
+        c |= b;
+        mismatches += c != u;
+
+        for (int i = 0; i < 200; ++i) {
+            const long long query = static_cast<long long>(base) - 50 + eng() % static_cast<unsigned>(span + 100);
+            if (query < int_min) {
+                continue;
+            }
+            const int serial = static_cast<int>(query);
+            mismatches += a.contains(SerialDate::from_serial(serial)) != (expected_a.count(serial) != 0);
+        }
+        return mismatches;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const int rounds = argc > 1 ? std::atoi(argv[1]) : 3000;
+    std::mt19937 eng{ 20230501 };
+    long mismatches = 0;
+    for (int r = 0; r < rounds; ++r) {
+        mismatches += check_round(eng);
+    }
+    std::printf("DateSet  tur=%d uyusmazlik=%ld\n", rounds, mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,111 @@
+// DateFlatMap ve DenseDayTable'ın std::map ile çapraz denetimi. Rastgele
+// ekleme/silme/arama dizileri, boş yuva işareti olan seri numarası ve int32
+// uçları dahil, aynı sonucu vermelidir.
+//
+// Derleme (depo kökünden):
+//   g++ -std=c++17 -O2 -I. check/date_table_check.cpp date.cpp date_parse.cpp date_format.cpp serial_date.cpp date_metrics.cpp date_random.cpp date_clock.cpp -o date_table_check
+// Kullanım:
+//   ./date_table_check [islem_sayisi]
+// Uyuşmazlık yoksa 0 ile çıkar.
+
+#include "date_table.h"
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <random>
+
+using namespace project;
+
+namespace {
+    constexpr int int_min = std::numeric_limits<int>::min();
+    constexpr int int_max = std::numeric_limits<int>::max();
+
+    // Çoğunlukla küçük bir aralık (çakışma ve geri kaydırma olsun), arada
+    // int32 uçları
+    int pick_key(std::mt19937& eng) {
+        const unsigned r = eng();
+        switch (r % 16) {
+            case 0:  return int_min;
+            case 1:  return int_min + 1 + static_cast<int>(r >> 8) % 4;
+            case 2:  return int_max - static_cast<int>(r >> 8) % 4;
+            default: return 693'596 + static_cast<int>(r >> 8) % 3000;
+        }
+    }
+
+    long check_flat_map(std::size_t operations) {
+        std::mt19937 eng{ 20240601 };
+        DateFlatMap<long> map;
+        std::map<int, long> expected;
+        long mismatches = 0;
+        for (std::size_t i = 0; i < operations; ++i) {
+            const int key = pick_key(eng);
+            const SerialDate date = SerialDate::from_serial(key);
+            switch (eng() % 8) {
+                case 0:
+                case 1:
+                case 2:
+                    map[date] += static_cast<long>(i);
+                    expected[key] += static_cast<long>(i);
+                    break;
+                case 3:
+                case 4:
+                    mismatches += map.erase(date) != (expected.erase(key) != 0);
+                    break;
+                case 5:
+                    if (eng() % 1024 == 0) {
+                        map.clear();
+                        expected.clear();
+                    }
+                    break;
+                default: {
+                    const long* found = map.find(date);
+                    const auto it = expected.find(key);
+                    if ((found != nullptr) != (it != expected.end()) || (found && *found != it->second) ||
+                        map.contains(date) != (found != nullptr)) {
+                        ++mismatches;
+                    }
+                    break;
+                }
+            }
+            mismatches += map.size() != expected.size();
+        }
+
+        std::size_t visited = 0;
+        for (const auto entry : map) {
+            const auto it = expected.find(entry.key.serial());
+            mismatches += it == expected.end() || it->second != entry.value;
+            ++visited;
+        }
+        map.for_each([&](SerialDate key, long& value) {
+            const auto it = expected.find(key.serial());
+            mismatches += it == expected.end() || it->second != value;
+            --visited;
+        });
+        mismatches += visited != 0;
+        return mismatches;
+    }
+
+    long check_dense_table() {
+        long mismatches = 0;
+        const DenseDayTable<int> table(Date(1, 1, 2000), Date(31, 12, 2000));
+        const int first = table.first().serial();
+        const int last = table.last().serial();
+        const int keys[] = { int_min, int_min + 1, first - 1, first, last, last + 1, int_max - 1, int_max };
+        for (const int key : keys) {
+            const bool inside = key >= first && key <= last;
+            mismatches += table.contains(SerialDate::from_serial(key)) != inside;
+        }
+        return mismatches;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t operations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2'000'000;
+
+    const long flat = check_flat_map(operations);
+    const long dense = check_dense_table();
+    std::printf("DateFlatMap    islem=%zu uyusmazlik=%ld\n", operations, flat);
+    std::printf("DenseDayTable  uyusmazlik=%ld\n", dense);
+    return flat + dense == 0 ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+// Tarih servisinin (service_mode.h) uçtan uca denetimi. Aynı süreçte
+// run_service başlatılır; DateClient::call tek çağrıda çok sayıda karışık
+// istek gönderir (varsayılan 1000000: sunucunun bekleyen yanıt sınırının
+// çok üstünde) ve her yanıt Date kütüphanesiyle tek tek hesaplanan sonuçla
+// karşılaştırılır.
+//
+// Derleme (depo kökünden):
+//   g++ -std=c++17 -O2 -I. check/service_check.cpp service_mode.cpp date_batch.cpp date_period.cpp date.cpp date_parse.cpp date_format.cpp serial_date.cpp date_metrics.cpp date_random.cpp date_clock.cpp -pthread -o service_check
+// Kullanım:
+//   ./service_check [istek_sayisi]
+// Uyuşmazlık yoksa 0 ile çıkar.
+
+#include "service_mode.h"
+#include "date_period.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+using namespace project;
+using namespace project::service;
+
+namespace {
+    std::int32_t random_packed(std::mt19937& eng) {
+        // Çoğunlukla geçerli; arada geçersiz gün, ay ve yıl
+        const int day = 1 + static_cast<int>(eng() % 31);
+        const int month = eng() % 64 == 0 ? 13 : 1 + static_cast<int>(eng() % 12);
+        const int year = eng() % 64 == 0 ? 1800 : 1900 + static_cast<int>(eng() % 300);
+        return year * 10000 + month * 100 + day;
+    }
+
+    Status reference_status(std::int32_t packed) {
+        switch (Date::check_date(packed % 100, packed / 100 % 100, packed / 10000)) {
+            case DateErrc::ok:            return Status::ok;
+            case DateErrc::invalid_month: return Status::invalid_month;
+            case DateErrc::invalid_day:   return Status::invalid_day;
+            default:                      return Status::invalid_year;
+        }
+    }
+
+    Date unpack(std::int32_t packed) {
+        return Date(packed % 100, packed / 100 % 100, packed / 10000);
+    }
+
+    Response reference(const Request& r) {
+        Response out;
+        out.id = r.id;
+        out.op = r.op;
+        switch (r.op) {
+            case Op::age:
+                out.status = reference_status(r.a);
+                if (out.status == Status::ok) {
+                    out.status = reference_status(r.b);
+                }
+                if (out.status == Status::ok) {
+                    if (unpack(r.b) < unpack(r.a)) {
+                        out.status = Status::birth_in_future;
+                    } else {
+                        const Period p = period_between(unpack(r.a), unpack(r.b));
+                        out.value[0] = p.years;
+                        out.value[1] = p.months;
+                        out.value[2] = p.days;
+                    }
+                }
+                break;
+            case Op::diff:
+                out.status = reference_status(r.a);
+                if (out.status == Status::ok) {
+                    out.status = reference_status(r.b);
+                }
+                if (out.status == Status::ok) {
+                    out.value[0] = unpack(r.b).get_day_serial() - unpack(r.a).get_day_serial();
+                }
+                break;
+            case Op::add_days:
+                out.status = reference_status(r.a);
+                if (out.status == Status::ok) {
+                    const int serial = unpack(r.a).get_day_serial() + r.b;
+                    const Date result = Date::from_day_serial(serial);
+                    if (result.get_year() < Date::year_base) {
+                        out.status = Status::invalid_year;
+                    } else {
+                        out.value[0] = pack_date(result);
+                    }
+                }
+                break;
+            case Op::weekday:
+                out.status = reference_status(r.a);
+                if (out.status == Status::ok) {
+                    out.value[0] = static_cast<int>(unpack(r.a).get_week_day());
+                }
+                break;
+            case Op::leap_check:
+                out.value[0] = (r.a % 4 == 0 && r.a % 100 != 0) || r.a % 400 == 0;
+                break;
+            default:
+                out.status = Status::invalid_op;
+                break;
+        }
+        return out;
+    }
+
+    bool same(const Response& a, const Response& b) {
+        return a.id == b.id && a.op == b.op && a.status == b.status && a.value[0] == b.value[0] &&
+               a.value[1] == b.value[1] && a.value[2] == b.value[2];
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+    const std::string path = "/tmp/date_service_check." + std::to_string(::getpid()) + ".sock";
+
+    std::atomic<bool> stop{ false };
+    std::thread server([&] {
+        try {
+            (void)run_service(path, ServiceOptions{}, stop);
+        } catch (const std::exception& e) {
+            std::fprintf(stderr, "%s\n", e.what());
+            std::exit(2);
+        }
+    });
+
+    std::mt19937 eng{ 20250301 };
+    std::vector<Request> requests(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        Request& r = requests[i];
+        r.id = static_cast<std::uint32_t>(i);
+        r.op = static_cast<Op>(1 + eng() % 6);   // 6: geçersiz işlem
+        r.a = random_packed(eng);
+        r.b = random_packed(eng);
+        if (r.op == Op::add_days) {
+            r.b = static_cast<std::int32_t>(eng() % 200'001) - 100'000;
+        } else if (r.op == Op::leap_check) {
+            r.a = static_cast<std::int32_t>(eng() % 5000) - 1000;
+        }
+    }
+
+    long mismatches = 0;
+    try {
+        // Sunucu dinlemeye başlayana kadar bağlantı denenir
+        DateClient client = [&] {
+            for (int attempt = 0;; ++attempt) {
+                try {
+                    return DateClient(path);
+                } catch (const std::exception&) {
+                    if (attempt == 100) {
+                        throw;
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                }
+            }
+        }();
+        std::vector<Response> responses(count);
+        client.call(requests.data(), responses.data(), count);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!same(responses[i], reference(requests[i]))) {
+                if (mismatches < 10) {
+                    std::printf("  istek %zu: op=%d a=%d b=%d durum=%d\n", i, static_cast<int>(requests[i].op),
+                                requests[i].a, requests[i].b, static_cast<int>(responses[i].status));
+                }
+                ++mismatches;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "%s\n", e.what());
+        mismatches = -1;
+    }
+
+    stop.store(true);
+    server.join();
+    std::printf("servis  istek=%zu uyusmazlik=%ld\n", count, mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
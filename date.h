@@ -3,12 +3,24 @@
 
 #include <iosfwd>
 #include <ctime>
+#include <functional>
 #include "date_exception.h"
+#include "date_civil.h"
+#include "date_metrics.h"
 
 namespace project {
+    // İstisna fırlatmayan API'lerin döndürdüğü hata kodları
+    enum class DateErrc {
+        ok, invalid_format, invalid_year, invalid_month, invalid_day, invalid_time
+    };
+
+    class DateResult;
+
     class Date {
     public:
         static constexpr int year_base = 1900;
+        // Gün seri numarası ve ara hesaplar int32'de taşmasın diye üst sınır
+        static constexpr int max_year = 999'999;
         static constexpr int random_min_year = 1940;
         static constexpr int random_max_year = 2020;
         
@@ -17,67 +29,395 @@ namespace project {
         };
         
         // Constructors
-        Date();
-        Date(int d, int m, int y);
+        constexpr Date() noexcept = default;
+        constexpr Date(int d, int m, int y);
         explicit Date(const char* p);
         explicit Date(std::time_t timer);
         
         // Getters
-        [[nodiscard]] int get_month_day() const;
-        [[nodiscard]] int get_month() const;
-        [[nodiscard]] int get_year() const;
-        [[nodiscard]] int get_year_day() const;
-        [[nodiscard]] Weekday get_week_day() const;
+        [[nodiscard]] constexpr int get_month_day() const noexcept;
+        [[nodiscard]] constexpr int get_month() const noexcept;
+        [[nodiscard]] constexpr int get_year() const noexcept;
+        [[nodiscard]] constexpr int get_year_day() const noexcept;
+        [[nodiscard]] constexpr Weekday get_week_day() const noexcept;
+        [[nodiscard]] constexpr int get_day_serial() const noexcept;
+
+        // ISO 8601 hafta numarası (1-53) ve haftanın ait olduğu yıl
+        [[nodiscard]] constexpr int get_iso_week() const noexcept;
+        [[nodiscard]] constexpr int get_iso_week_year() const noexcept;
+        [[nodiscard]] constexpr int get_quarter() const noexcept;
+        // Mali yıl first_month ayında başlar ve bittiği takvim yılıyla anılır;
+        // dönem, mali yılın kaçıncı ayı olduğudur (1-12).
+        [[nodiscard]] constexpr int get_fiscal_year(int first_month) const;
+        [[nodiscard]] constexpr int get_fiscal_period(int first_month) const;
         
         // Setters
-        Date& set_month_day(int day);
-        Date& set_month(int month);
-        Date& set_year(int year);
-        Date& set(int day, int mon, int year);
+        constexpr Date& set_month_day(int day);
+        constexpr Date& set_month(int month);
+        constexpr Date& set_year(int year);
+        constexpr Date& set(int day, int mon, int year);
+
+        // Non-throwing setters: hata durumunda tarih değişmez
+        [[nodiscard]] constexpr DateErrc try_set_month_day(int day) noexcept;
+        [[nodiscard]] constexpr DateErrc try_set_month(int month) noexcept;
+        [[nodiscard]] constexpr DateErrc try_set_year(int year) noexcept;
+        [[nodiscard]] constexpr DateErrc try_set(int day, int mon, int year) noexcept;
         
         // Arithmetic operators
-        [[nodiscard]] Date operator-(int day) const;
-        Date& operator+=(int day);
-        Date& operator-=(int day);
-        Date& operator++();
-        Date operator++(int);
-        Date& operator--();
-        Date operator--(int);
+        [[nodiscard]] constexpr Date operator-(int day) const;
+        constexpr Date& operator+=(int day) noexcept;
+        constexpr Date& operator-=(int day) noexcept;
+        constexpr Date& operator++() noexcept;
+        constexpr Date operator++(int) noexcept;
+        constexpr Date& operator--() noexcept;
+        constexpr Date operator--(int) noexcept;
         
         // Static functions
         [[nodiscard]] static Date random_date();
-        static constexpr bool isleap(int y);
+        [[nodiscard]] static constexpr Date from_day_serial(int serial) noexcept;
+        // Doğrulama yapmaz; c geçerli bir takvim tarihi olmalıdır.
+        [[nodiscard]] static constexpr Date from_civil(const civil::CivilDate& c) noexcept;
+        [[nodiscard]] static constexpr DateErrc check_date(int d, int m, int y) noexcept;
+        [[nodiscard]] static constexpr DateResult try_make(int d, int m, int y) noexcept;
+        static constexpr bool isleap(int y) { return civil::is_leap(y); }
         
         // Friend declarations for comparison operators
-        friend bool operator<(const Date&, const Date&);
-        friend bool operator==(const Date&, const Date&);
+        friend constexpr bool operator<(const Date&, const Date&) noexcept;
+        friend constexpr bool operator==(const Date&, const Date&) noexcept;
         
         // Friend declarations for stream operators
         friend std::ostream& operator<<(std::ostream& os, const Date& date);
         friend std::istream& operator>>(std::istream& is, Date& date);
         
     private:
-        int m_day;
-        int m_month;
-        int m_year;
+        static constexpr void validate_date(int day, int month, int year);
+
+        int m_day{ 1 };
+        int m_month{ 1 };
+        int m_year{ year_base };
     };
     
+    // Hata koduna karşılık gelen istisnayı fırlatır (ec != DateErrc::ok).
+    [[noreturn]] void throw_date_error(DateErrc ec, int d, int m, int y);
+    [[nodiscard]] const char* to_string(DateErrc ec) noexcept;
+
+    // Date ya da hata kodu taşır (std::expected<Date, DateErrc> benzeri).
+    class DateResult {
+    public:
+        constexpr DateResult(const Date& value) noexcept : m_value(value), m_error(DateErrc::ok) {}
+        constexpr DateResult(DateErrc error) noexcept : m_error(error) {}
+
+        [[nodiscard]] constexpr bool has_value() const noexcept { return m_error == DateErrc::ok; }
+        constexpr explicit operator bool() const noexcept { return has_value(); }
+        [[nodiscard]] constexpr DateErrc error() const noexcept { return m_error; }
+
+        [[nodiscard]] constexpr const Date& operator*() const noexcept { return m_value; }
+        [[nodiscard]] constexpr const Date* operator->() const noexcept { return &m_value; }
+        [[nodiscard]] constexpr Date value_or(const Date& other) const noexcept {
+            return has_value() ? m_value : other;
+        }
+
+    private:
+        Date m_value;
+        DateErrc m_error;
+    };
+
     // Global comparison operators
-    [[nodiscard]] bool operator<=(const Date&, const Date&);
-    [[nodiscard]] bool operator>(const Date&, const Date&);
-    [[nodiscard]] bool operator>=(const Date&, const Date&);
-    [[nodiscard]] bool operator!=(const Date&, const Date&);
+    [[nodiscard]] constexpr bool operator<=(const Date&, const Date&) noexcept;
+    [[nodiscard]] constexpr bool operator>(const Date&, const Date&) noexcept;
+    [[nodiscard]] constexpr bool operator>=(const Date&, const Date&) noexcept;
+    [[nodiscard]] constexpr bool operator!=(const Date&, const Date&) noexcept;
     
     // Date arithmetic
-    [[nodiscard]] int operator-(const Date& d1, const Date& d2);
-    [[nodiscard]] Date operator+(const Date& date, int n);
-    [[nodiscard]] Date operator+(int n, const Date&);
+    [[nodiscard]] constexpr int operator-(const Date& d1, const Date& d2) noexcept;
+    [[nodiscard]] constexpr Date operator+(const Date& date, int n) noexcept;
+    [[nodiscard]] constexpr Date operator+(int n, const Date&) noexcept;
     
     // Weekday operators
-    Date::Weekday& operator++(Date::Weekday& r);
-    Date::Weekday operator++(Date::Weekday& r, int);
-    Date::Weekday& operator--(Date::Weekday& r);
-    Date::Weekday operator--(Date::Weekday& r, int);
+    constexpr Date::Weekday& operator++(Date::Weekday& r) noexcept;
+    constexpr Date::Weekday operator++(Date::Weekday& r, int) noexcept;
+    constexpr Date::Weekday& operator--(Date::Weekday& r) noexcept;
+    constexpr Date::Weekday operator--(Date::Weekday& r, int) noexcept;
+
+    // Inline implementations
+    // Sabit ifadelerde kullanılabilmeleri için çekirdek işlemler başlıkta
+    // tanımlıdır; geçersiz tarih derleme anında derleme hatası olur.
+
+    constexpr DateErrc Date::check_date(int day, int month, int year) noexcept {
+        // Yıl kontrolü
+        if (year < year_base || year > max_year) {
+            return DateErrc::invalid_year;
+        }
+        
+        // Ay kontrolü
+        if (month < 1 || month > 12) {
+            return DateErrc::invalid_month;
+        }
+        
+        // Gün kontrolü
+        if (day < 1 || day > civil::days_in_month(month, year)) {
+            return DateErrc::invalid_day;
+        }
+        
+        return DateErrc::ok;
+    }
+
+    constexpr void Date::validate_date(int day, int month, int year) {
+        const DateErrc ec = check_date(day, month, year);
+        if (ec != DateErrc::ok) {
+            throw_date_error(ec, day, month, year);
+        }
+    }
+
+    constexpr DateResult Date::try_make(int d, int m, int y) noexcept {
+        const DateErrc ec = check_date(d, m, y);
+        if (ec != DateErrc::ok) {
+            PROJECT_DATE_METRIC_COUNT(validation_failed);
+            return ec;
+        }
+        Date date;
+        date.m_day = d;
+        date.m_month = m;
+        date.m_year = y;
+        return date;
+    }
+
+    constexpr Date Date::from_day_serial(int serial) noexcept {
+        return from_civil(civil::civil_from_days(serial));
+    }
+
+    constexpr Date Date::from_civil(const civil::CivilDate& c) noexcept {
+        Date date;
+        date.m_day = c.day;
+        date.m_month = c.month;
+        date.m_year = c.year;
+        return date;
+    }
+
+    // Constructors
+    constexpr Date::Date(int d, int m, int y)
+        : m_day((validate_date(d, m, y), d)), m_month(m), m_year(y) {
+        PROJECT_DATE_METRIC_COUNT(construct);
+    }
+
+    // Getters
+    constexpr int Date::get_month_day() const noexcept {
+        return m_day;
+    }
+
+    constexpr int Date::get_month() const noexcept {
+        return m_month;
+    }
+
+    constexpr int Date::get_year() const noexcept {
+        return m_year;
+    }
+
+    constexpr int Date::get_year_day() const noexcept {
+        return civil::year_day(m_day, m_month, m_year);
+    }
+
+    constexpr int Date::get_iso_week() const noexcept {
+        return civil::iso_week(get_day_serial()).week;
+    }
+
+    constexpr int Date::get_iso_week_year() const noexcept {
+        return civil::iso_week(get_day_serial()).year;
+    }
+
+    constexpr int Date::get_quarter() const noexcept {
+        return civil::quarter(m_month);
+    }
+
+    constexpr int Date::get_fiscal_year(int first_month) const {
+        if (first_month < 1 || first_month > 12) {
+            throw_date_error(DateErrc::invalid_month, m_day, first_month, m_year);
+        }
+        return civil::fiscal_year(m_month, m_year, first_month);
+    }
+
+    constexpr int Date::get_fiscal_period(int first_month) const {
+        if (first_month < 1 || first_month > 12) {
+            throw_date_error(DateErrc::invalid_month, m_day, first_month, m_year);
+        }
+        return civil::fiscal_period(m_month, first_month);
+    }
+
+    constexpr Date::Weekday Date::get_week_day() const noexcept {
+        // 01/01/0001 Pazartesi'dir; seri % 7 doğrudan Weekday değerini verir.
+        const int serial = get_day_serial();
+        return static_cast<Weekday>((serial % 7 + 7) % 7);
+    }
+
+    constexpr int Date::get_day_serial() const noexcept {
+        return civil::days_from_civil(m_day, m_month, m_year);
+    }
+
+    // Setters
+    constexpr Date& Date::set_month_day(int day) {
+        validate_date(day, m_month, m_year);
+        m_day = day;
+        return *this;
+    }
+
+    constexpr Date& Date::set_month(int month) {
+        validate_date(m_day, month, m_year);
+        m_month = month;
+        return *this;
+    }
+
+    constexpr Date& Date::set_year(int year) {
+        validate_date(m_day, m_month, year);
+        m_year = year;
+        return *this;
+    }
+
+    constexpr Date& Date::set(int day, int mon, int year) {
+        validate_date(day, mon, year);
+        m_day = day;
+        m_month = mon;
+        m_year = year;
+        return *this;
+    }
+
+    constexpr DateErrc Date::try_set_month_day(int day) noexcept {
+        return try_set(day, m_month, m_year);
+    }
+
+    constexpr DateErrc Date::try_set_month(int month) noexcept {
+        return try_set(m_day, month, m_year);
+    }
+
+    constexpr DateErrc Date::try_set_year(int year) noexcept {
+        return try_set(m_day, m_month, year);
+    }
+
+    constexpr DateErrc Date::try_set(int day, int mon, int year) noexcept {
+        const DateErrc ec = check_date(day, mon, year);
+        if (ec != DateErrc::ok) {
+            PROJECT_DATE_METRIC_COUNT(validation_failed);
+            return ec;
+        }
+        m_day = day;
+        m_month = mon;
+        m_year = year;
+        return ec;
+    }
+
+    // Arithmetic operators
+    constexpr Date Date::operator-(int day) const {
+        PROJECT_DATE_METRIC_COUNT(arithmetic);
+        const Date date = from_day_serial(get_day_serial() - day);
+        return Date{ date.m_day, date.m_month, date.m_year };
+    }
+
+    constexpr Date& Date::operator+=(int day) noexcept {
+        PROJECT_DATE_METRIC_COUNT(arithmetic);
+        return *this = from_day_serial(get_day_serial() + day);
+    }
+
+    constexpr Date& Date::operator-=(int day) noexcept {
+        PROJECT_DATE_METRIC_COUNT(arithmetic);
+        return *this = from_day_serial(get_day_serial() - day);
+    }
+
+    constexpr Date& Date::operator++() noexcept {
+        *this += 1;
+        return *this;
+    }
+
+    constexpr Date Date::operator++(int) noexcept {
+        Date temp{ *this };
+        ++(*this);
+        return temp;
+    }
+
+    constexpr Date& Date::operator--() noexcept {
+        *this -= 1;
+        return *this;
+    }
+
+    constexpr Date Date::operator--(int) noexcept {
+        Date temp{ *this };
+        --(*this);
+        return temp;
+    }
+
+    // Comparison operators
+    constexpr bool operator<(const Date& d1, const Date& d2) noexcept {
+        if (d1.m_year != d2.m_year)
+            return d1.m_year < d2.m_year;
+        if (d1.m_month != d2.m_month)
+            return d1.m_month < d2.m_month;
+        return d1.m_day < d2.m_day;
+    }
+
+    constexpr bool operator==(const Date& d1, const Date& d2) noexcept {
+        return d1.m_day == d2.m_day && d1.m_month == d2.m_month && d1.m_year == d2.m_year;
+    }
+
+    constexpr bool operator<=(const Date& d1, const Date& d2) noexcept {
+        return d1 < d2 || d1 == d2;
+    }
+
+    constexpr bool operator>(const Date& d1, const Date& d2) noexcept {
+        return !(d1 <= d2);
+    }
+
+    constexpr bool operator>=(const Date& d1, const Date& d2) noexcept {
+        return !(d1 < d2);
+    }
+
+    constexpr bool operator!=(const Date& d1, const Date& d2) noexcept {
+        return !(d1 == d2);
+    }
+
+    // Date difference
+    constexpr int operator-(const Date& d1, const Date& d2) noexcept {
+        return d1.get_day_serial() - d2.get_day_serial();
+    }
+
+    // Date + int
+    constexpr Date operator+(const Date& date, int n) noexcept {
+        Date temp{ date };
+        temp += n;
+        return temp;
+    }
+
+    constexpr Date operator+(int n, const Date& date) noexcept {
+        return date + n;
+    }
+
+    // Weekday operators
+    constexpr Date::Weekday& operator++(Date::Weekday& r) noexcept {
+        r = static_cast<Date::Weekday>((static_cast<int>(r) + 1) % 7);
+        return r;
+    }
+
+    constexpr Date::Weekday operator++(Date::Weekday& r, int) noexcept {
+        Date::Weekday temp{ r };
+        ++r;
+        return temp;
+    }
+
+    constexpr Date::Weekday& operator--(Date::Weekday& r) noexcept {
+        r = static_cast<Date::Weekday>((static_cast<int>(r) + 6) % 7);
+        return r;
+    }
+
+    constexpr Date::Weekday operator--(Date::Weekday& r, int) noexcept {
+        Date::Weekday temp{ r };
+        --r;
+        return temp;
+    }
 }
 
+// Sırasız kaplar için: eşit tarihler eşit seri numarasına sahiptir.
+template <>
+struct std::hash<project::Date> {
+    [[nodiscard]] std::size_t operator()(const project::Date& date) const noexcept {
+        return std::hash<int>{}(date.get_day_serial());
+    }
+};
+
 #endif
@@ -0,0 +1,693 @@
+#include "date_batch.h"
+#include "date_civil.h"
+#include <algorithm>
+#include <cstring>
+
+namespace project::batch {
+
+    // Helper functions
+    namespace {
+        inline int week_day(int serial) noexcept {
+            return (serial % 7 + 7) % 7;
+        }
+
+        inline int year_day(int serial) noexcept {
+            const civil::CivilDate c = civil::civil_from_days(serial);
+            return civil::year_day(c.day, c.month, c.year);
+        }
+
+#if PROJECT_DATE_X86_DISPATCH
+        // Vektör yolunda civil algoritması double şeritlerde çalışır: tamsayı
+        // bölme SIMD'de yoktur; bölme floor((x + 0.5) * (1 / c)) ile yapılır
+        // (kesir payı 0.5 / c'den küçük olamaz). Sonuçların skaler yolla
+        // birebir aynı olduğu 01/01/-999999 - 31/12/999999 arasındaki her
+        // seri için check/date_batch_check.cpp ile doğrulanmıştır; bu aralığın
+        // dışı denenmemiştir. floor için SSE4.1 roundpd kullanılır.
+
+        // --- AVX2: 4 şerit ---
+        namespace avx2 {
+            PROJECT_DATE_TARGET("avx2")
+            inline __m256d fdiv(__m256d x, double c) noexcept {
+                return _mm256_floor_pd(_mm256_mul_pd(_mm256_add_pd(x, _mm256_set1_pd(0.5)),
+                                                     _mm256_set1_pd(1.0 / c)));
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            inline __m256d fmod(__m256d x, double c) noexcept {
+                return _mm256_sub_pd(x, _mm256_mul_pd(fdiv(x, c), _mm256_set1_pd(c)));
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            inline __m256d leap(__m256d y) noexcept {
+                const __m256d zero = _mm256_setzero_pd();
+                const __m256d by4 = _mm256_cmp_pd(fmod(y, 4), zero, _CMP_EQ_OQ);
+                const __m256d by100 = _mm256_cmp_pd(fmod(y, 100), zero, _CMP_NEQ_OQ);
+                const __m256d by400 = _mm256_cmp_pd(fmod(y, 400), zero, _CMP_EQ_OQ);
+                return _mm256_and_pd(by4, _mm256_or_pd(by100, by400));
+            }
+
+            // doy: 1 Mart'tan itibaren gün (0-365)
+            PROJECT_DATE_TARGET("avx2")
+            inline void civil(__m128i serials, __m256d& day, __m256d& month, __m256d& year, __m256d& doy) noexcept {
+                const __m256d z = _mm256_add_pd(_mm256_cvtepi32_pd(serials), _mm256_set1_pd(305));
+                const __m256d era = fdiv(z, 146097);
+                const __m256d doe = _mm256_sub_pd(z, _mm256_mul_pd(era, _mm256_set1_pd(146097)));
+                const __m256d yoe = fdiv(_mm256_sub_pd(_mm256_add_pd(_mm256_sub_pd(doe, fdiv(doe, 1460)),
+                                                                     fdiv(doe, 36524)),
+                                                       fdiv(doe, 146096)), 365);
+                doy = _mm256_sub_pd(doe, _mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(yoe, _mm256_set1_pd(365)),
+                                                                     fdiv(yoe, 4)),
+                                                       fdiv(yoe, 100)));
+                const __m256d mp = fdiv(_mm256_add_pd(_mm256_mul_pd(doy, _mm256_set1_pd(5)), _mm256_set1_pd(2)), 153);
+                day = _mm256_add_pd(_mm256_sub_pd(doy, fdiv(_mm256_add_pd(_mm256_mul_pd(mp, _mm256_set1_pd(153)),
+                                                                          _mm256_set1_pd(2)), 5)),
+                                    _mm256_set1_pd(1));
+                const __m256d wrap = _mm256_cmp_pd(mp, _mm256_set1_pd(10), _CMP_GE_OQ);
+                month = _mm256_sub_pd(_mm256_add_pd(mp, _mm256_set1_pd(3)),
+                                      _mm256_and_pd(wrap, _mm256_set1_pd(12)));
+                year = _mm256_add_pd(_mm256_add_pd(yoe, _mm256_mul_pd(era, _mm256_set1_pd(400))),
+                                     _mm256_and_pd(wrap, _mm256_set1_pd(1)));
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            inline __m256d year_day(__m256d month, __m256d year, __m256d doy) noexcept {
+                const __m256d early = _mm256_cmp_pd(month, _mm256_set1_pd(2), _CMP_LE_OQ);
+                const __m256d from_march = _mm256_add_pd(_mm256_add_pd(doy, _mm256_set1_pd(60)),
+                                                         _mm256_and_pd(leap(year), _mm256_set1_pd(1)));
+                return _mm256_blendv_pd(from_march, _mm256_sub_pd(doy, _mm256_set1_pd(305)), early);
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            inline __m128i to_int(__m256d v) noexcept {
+                return _mm256_cvttpd_epi32(v);
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            inline void store_u8(std::uint8_t* out, __m128i v) noexcept {
+                const int packed = _mm_cvtsi128_si32(
+                    _mm_shuffle_epi8(v, _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)));
+                std::memcpy(out, &packed, 4);
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            inline __m128i load4(const std::int32_t* p) noexcept {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            std::size_t add_days(const std::int32_t* s, std::int32_t n, std::int32_t* out, std::size_t count) noexcept {
+                const __m256i vn = _mm256_set1_epi32(n);
+                std::size_t i = 0;
+                for (; i + 8 <= count; i += 8) {
+                    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_add_epi32(v, vn));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            std::size_t add_days(const std::int32_t* s, const std::int32_t* n, std::int32_t* out, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 8 <= count; i += 8) {
+                    const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+                    const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(n + i));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_add_epi32(a, b));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            std::size_t diff_days(const std::int32_t* d1, const std::int32_t* d2, std::int32_t* out, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 8 <= count; i += 8) {
+                    const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(d1 + i));
+                    const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(d2 + i));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_sub_epi32(a, b));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            std::size_t week_days(const std::int32_t* s, std::uint8_t* out, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    store_u8(out + i, to_int(fmod(_mm256_cvtepi32_pd(load4(s + i)), 7)));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            std::size_t year_days(const std::int32_t* s, std::uint16_t* out, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    __m256d d, m, y, doy;
+                    civil(load4(s + i), d, m, y, doy);
+                    const __m128i v = to_int(year_day(m, y, doy));
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi32(v, v));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            std::size_t leap_flags(const std::int32_t* s, std::uint8_t* out, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    __m256d d, m, y, doy;
+                    civil(load4(s + i), d, m, y, doy);
+                    store_u8(out + i, to_int(_mm256_and_pd(leap(y), _mm256_set1_pd(1))));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            std::size_t leap_flags_from_years(const std::int32_t* years, std::uint8_t* out, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    const __m256d y = _mm256_cvtepi32_pd(load4(years + i));
+                    store_u8(out + i, to_int(_mm256_and_pd(leap(y), _mm256_set1_pd(1))));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            std::size_t to_serials(const std::int32_t* days, const std::int32_t* months, const std::int32_t* years,
+                                   std::int32_t* out, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    const __m256d d = _mm256_cvtepi32_pd(load4(days + i));
+                    const __m256d m = _mm256_cvtepi32_pd(load4(months + i));
+                    const __m256d early = _mm256_cmp_pd(m, _mm256_set1_pd(2), _CMP_LE_OQ);
+                    const __m256d y = _mm256_sub_pd(_mm256_cvtepi32_pd(load4(years + i)),
+                                                    _mm256_and_pd(early, _mm256_set1_pd(1)));
+                    const __m256d era = fdiv(y, 400);
+                    const __m256d yoe = _mm256_sub_pd(y, _mm256_mul_pd(era, _mm256_set1_pd(400)));
+                    const __m256d mp = _mm256_add_pd(_mm256_sub_pd(m, _mm256_set1_pd(3)),
+                                                     _mm256_and_pd(early, _mm256_set1_pd(12)));
+                    const __m256d doy = _mm256_add_pd(fdiv(_mm256_add_pd(_mm256_mul_pd(mp, _mm256_set1_pd(153)),
+                                                                         _mm256_set1_pd(2)), 5),
+                                                      _mm256_sub_pd(d, _mm256_set1_pd(1)));
+                    const __m256d doe = _mm256_add_pd(_mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(yoe, _mm256_set1_pd(365)),
+                                                                                  fdiv(yoe, 4)),
+                                                                    fdiv(yoe, 100)),
+                                                      doy);
+                    const __m256d serial = _mm256_add_pd(_mm256_mul_pd(era, _mm256_set1_pd(146097)),
+                                                         _mm256_sub_pd(doe, _mm256_set1_pd(305)));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), to_int(serial));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            std::size_t from_serials(const std::int32_t* s, std::int32_t* days, std::int32_t* months,
+                                     std::int32_t* years, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    __m256d d, m, y, doy;
+                    civil(load4(s + i), d, m, y, doy);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(days + i), to_int(d));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(months + i), to_int(m));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(years + i), to_int(y));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            std::size_t calendar_columns(const std::int32_t* s, const CalendarColumns& out, std::size_t count,
+                                         int fiscal_first_month) noexcept {
+                const __m256d one = _mm256_set1_pd(1);
+                const __m256d first = _mm256_set1_pd(fiscal_first_month);
+                const __m256d next_year = _mm256_set1_pd(fiscal_first_month != 1 ? 1 : 0);
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    const __m128i serials = load4(s + i);
+                    __m256d d, m, y, doy;
+                    civil(serials, d, m, y, doy);
+                    if (out.iso_week || out.iso_year) {
+                        // Haftanın Perşembesi (Pazartesi = 0)
+                        const __m256d v = _mm256_cvtepi32_pd(serials);
+                        const __m256d iso_day = fmod(_mm256_add_pd(v, _mm256_set1_pd(6)), 7);
+                        __m256d td, tm, ty, tdoy;
+                        civil(to_int(_mm256_add_pd(_mm256_sub_pd(v, iso_day), _mm256_set1_pd(3))), td, tm, ty, tdoy);
+                        if (out.iso_week) {
+                            store_u8(out.iso_week + i,
+                                     to_int(_mm256_add_pd(fdiv(_mm256_sub_pd(year_day(tm, ty, tdoy), one), 7), one)));
+                        }
+                        if (out.iso_year) {
+                            _mm_storeu_si128(reinterpret_cast<__m128i*>(out.iso_year + i), to_int(ty));
+                        }
+                    }
+                    if (out.quarter) {
+                        store_u8(out.quarter + i, to_int(fdiv(_mm256_add_pd(m, _mm256_set1_pd(2)), 3)));
+                    }
+                    const __m256d after = _mm256_cmp_pd(m, first, _CMP_GE_OQ);
+                    if (out.fiscal_year) {
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out.fiscal_year + i),
+                                         to_int(_mm256_add_pd(y, _mm256_and_pd(after, next_year))));
+                    }
+                    if (out.fiscal_period) {
+                        const __m256d period = _mm256_add_pd(_mm256_sub_pd(m, first),
+                                                             _mm256_add_pd(one, _mm256_andnot_pd(after, _mm256_set1_pd(12))));
+                        store_u8(out.fiscal_period + i, to_int(period));
+                    }
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("avx2")
+            std::size_t bucket_ids(const std::int32_t* s, std::uint16_t* out, std::size_t count, Bucket bucket) noexcept {
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    const __m128i serials = load4(s + i);
+                    __m256d value;
+                    if (bucket == Bucket::weekday) {
+                        value = fmod(_mm256_cvtepi32_pd(serials), 7);
+                    } else {
+                        __m256d d, m, y, doy;
+                        if (bucket == Bucket::iso_week) {
+                            const __m256d v = _mm256_cvtepi32_pd(serials);
+                            const __m256d iso_day = fmod(_mm256_add_pd(v, _mm256_set1_pd(6)), 7);
+                            civil(to_int(_mm256_add_pd(_mm256_sub_pd(v, iso_day), _mm256_set1_pd(3))), d, m, y, doy);
+                        } else {
+                            civil(serials, d, m, y, doy);
+                        }
+                        switch (bucket) {
+                            case Bucket::month:    value = m; break;
+                            case Bucket::quarter:  value = fdiv(_mm256_add_pd(m, _mm256_set1_pd(2)), 3); break;
+                            case Bucket::iso_week:
+                                value = _mm256_add_pd(fdiv(_mm256_sub_pd(year_day(m, y, doy), _mm256_set1_pd(1)), 7),
+                                                      _mm256_set1_pd(1));
+                                break;
+                            case Bucket::year_day: value = year_day(m, y, doy); break;
+                            default:               value = y; break;
+                        }
+                    }
+                    const __m128i v = to_int(value);
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi32(v, v));
+                }
+                return i;
+            }
+        }
+
+        // --- SSE4.1: 2 şerit ---
+        namespace sse41 {
+            PROJECT_DATE_TARGET("sse4.1")
+            inline __m128d fdiv(__m128d x, double c) noexcept {
+                return _mm_floor_pd(_mm_mul_pd(_mm_add_pd(x, _mm_set1_pd(0.5)), _mm_set1_pd(1.0 / c)));
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            inline __m128d fmod(__m128d x, double c) noexcept {
+                return _mm_sub_pd(x, _mm_mul_pd(fdiv(x, c), _mm_set1_pd(c)));
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            inline __m128d leap(__m128d y) noexcept {
+                const __m128d zero = _mm_setzero_pd();
+                const __m128d by4 = _mm_cmpeq_pd(fmod(y, 4), zero);
+                const __m128d by100 = _mm_cmpneq_pd(fmod(y, 100), zero);
+                const __m128d by400 = _mm_cmpeq_pd(fmod(y, 400), zero);
+                return _mm_and_pd(by4, _mm_or_pd(by100, by400));
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            inline void civil(__m128i serials, __m128d& day, __m128d& month, __m128d& year, __m128d& doy) noexcept {
+                const __m128d z = _mm_add_pd(_mm_cvtepi32_pd(serials), _mm_set1_pd(305));
+                const __m128d era = fdiv(z, 146097);
+                const __m128d doe = _mm_sub_pd(z, _mm_mul_pd(era, _mm_set1_pd(146097)));
+                const __m128d yoe = fdiv(_mm_sub_pd(_mm_add_pd(_mm_sub_pd(doe, fdiv(doe, 1460)), fdiv(doe, 36524)),
+                                                    fdiv(doe, 146096)), 365);
+                doy = _mm_sub_pd(doe, _mm_sub_pd(_mm_add_pd(_mm_mul_pd(yoe, _mm_set1_pd(365)), fdiv(yoe, 4)),
+                                                 fdiv(yoe, 100)));
+                const __m128d mp = fdiv(_mm_add_pd(_mm_mul_pd(doy, _mm_set1_pd(5)), _mm_set1_pd(2)), 153);
+                day = _mm_add_pd(_mm_sub_pd(doy, fdiv(_mm_add_pd(_mm_mul_pd(mp, _mm_set1_pd(153)), _mm_set1_pd(2)), 5)),
+                                 _mm_set1_pd(1));
+                const __m128d wrap = _mm_cmpge_pd(mp, _mm_set1_pd(10));
+                month = _mm_sub_pd(_mm_add_pd(mp, _mm_set1_pd(3)), _mm_and_pd(wrap, _mm_set1_pd(12)));
+                year = _mm_add_pd(_mm_add_pd(yoe, _mm_mul_pd(era, _mm_set1_pd(400))), _mm_and_pd(wrap, _mm_set1_pd(1)));
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            inline __m128d year_day(__m128d month, __m128d year, __m128d doy) noexcept {
+                const __m128d early = _mm_cmple_pd(month, _mm_set1_pd(2));
+                const __m128d from_march = _mm_add_pd(_mm_add_pd(doy, _mm_set1_pd(60)),
+                                                      _mm_and_pd(leap(year), _mm_set1_pd(1)));
+                return _mm_blendv_pd(from_march, _mm_sub_pd(doy, _mm_set1_pd(305)), early);
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            inline void store_u8(std::uint8_t* out, __m128i v) noexcept {
+                const int packed = _mm_cvtsi128_si32(
+                    _mm_shuffle_epi8(v, _mm_setr_epi8(0, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)));
+                std::memcpy(out, &packed, 2);
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            inline void store_i32(std::int32_t* out, __m128i v) noexcept {
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out), v);
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            inline __m128i load2(const std::int32_t* p) noexcept {
+                return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            std::size_t add_days(const std::int32_t* s, std::int32_t n, std::int32_t* out, std::size_t count) noexcept {
+                const __m128i vn = _mm_set1_epi32(n);
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi32(v, vn));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            std::size_t add_days(const std::int32_t* s, const std::int32_t* n, std::int32_t* out, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+                    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n + i));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi32(a, b));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            std::size_t diff_days(const std::int32_t* d1, const std::int32_t* d2, std::int32_t* out, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d1 + i));
+                    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d2 + i));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_sub_epi32(a, b));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            std::size_t week_days(const std::int32_t* s, std::uint8_t* out, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    store_u8(out + i, _mm_cvttpd_epi32(fmod(_mm_cvtepi32_pd(load2(s + i)), 7)));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            std::size_t year_days(const std::int32_t* s, std::uint16_t* out, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    __m128d d, m, y, doy;
+                    civil(load2(s + i), d, m, y, doy);
+                    const __m128i v = _mm_cvttpd_epi32(year_day(m, y, doy));
+                    const int packed = _mm_cvtsi128_si32(_mm_packus_epi32(v, v));
+                    std::memcpy(out + i, &packed, 4);
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            std::size_t leap_flags(const std::int32_t* s, std::uint8_t* out, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    __m128d d, m, y, doy;
+                    civil(load2(s + i), d, m, y, doy);
+                    store_u8(out + i, _mm_cvttpd_epi32(_mm_and_pd(leap(y), _mm_set1_pd(1))));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            std::size_t leap_flags_from_years(const std::int32_t* years, std::uint8_t* out, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    const __m128d y = _mm_cvtepi32_pd(load2(years + i));
+                    store_u8(out + i, _mm_cvttpd_epi32(_mm_and_pd(leap(y), _mm_set1_pd(1))));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            std::size_t to_serials(const std::int32_t* days, const std::int32_t* months, const std::int32_t* years,
+                                   std::int32_t* out, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    const __m128d d = _mm_cvtepi32_pd(load2(days + i));
+                    const __m128d m = _mm_cvtepi32_pd(load2(months + i));
+                    const __m128d early = _mm_cmple_pd(m, _mm_set1_pd(2));
+                    const __m128d y = _mm_sub_pd(_mm_cvtepi32_pd(load2(years + i)), _mm_and_pd(early, _mm_set1_pd(1)));
+                    const __m128d era = fdiv(y, 400);
+                    const __m128d yoe = _mm_sub_pd(y, _mm_mul_pd(era, _mm_set1_pd(400)));
+                    const __m128d mp = _mm_add_pd(_mm_sub_pd(m, _mm_set1_pd(3)), _mm_and_pd(early, _mm_set1_pd(12)));
+                    const __m128d doy = _mm_add_pd(fdiv(_mm_add_pd(_mm_mul_pd(mp, _mm_set1_pd(153)), _mm_set1_pd(2)), 5),
+                                                   _mm_sub_pd(d, _mm_set1_pd(1)));
+                    const __m128d doe = _mm_add_pd(_mm_sub_pd(_mm_add_pd(_mm_mul_pd(yoe, _mm_set1_pd(365)), fdiv(yoe, 4)),
+                                                              fdiv(yoe, 100)),
+                                                   doy);
+                    const __m128d serial = _mm_add_pd(_mm_mul_pd(era, _mm_set1_pd(146097)),
+                                                      _mm_sub_pd(doe, _mm_set1_pd(305)));
+                    store_i32(out + i, _mm_cvttpd_epi32(serial));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            std::size_t from_serials(const std::int32_t* s, std::int32_t* days, std::int32_t* months,
+                                     std::int32_t* years, std::size_t count) noexcept {
+                std::size_t i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    __m128d d, m, y, doy;
+                    civil(load2(s + i), d, m, y, doy);
+                    store_i32(days + i, _mm_cvttpd_epi32(d));
+                    store_i32(months + i, _mm_cvttpd_epi32(m));
+                    store_i32(years + i, _mm_cvttpd_epi32(y));
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            std::size_t calendar_columns(const std::int32_t* s, const CalendarColumns& out, std::size_t count,
+                                         int fiscal_first_month) noexcept {
+                const __m128d one = _mm_set1_pd(1);
+                const __m128d first = _mm_set1_pd(fiscal_first_month);
+                const __m128d next_year = _mm_set1_pd(fiscal_first_month != 1 ? 1 : 0);
+                std::size_t i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    const __m128i serials = load2(s + i);
+                    __m128d d, m, y, doy;
+                    civil(serials, d, m, y, doy);
+                    if (out.iso_week || out.iso_year) {
+                        const __m128d v = _mm_cvtepi32_pd(serials);
+                        const __m128d iso_day = fmod(_mm_add_pd(v, _mm_set1_pd(6)), 7);
+                        __m128d td, tm, ty, tdoy;
+                        civil(_mm_cvttpd_epi32(_mm_add_pd(_mm_sub_pd(v, iso_day), _mm_set1_pd(3))), td, tm, ty, tdoy);
+                        if (out.iso_week) {
+                            store_u8(out.iso_week + i,
+                                     _mm_cvttpd_epi32(_mm_add_pd(fdiv(_mm_sub_pd(year_day(tm, ty, tdoy), one), 7), one)));
+                        }
+                        if (out.iso_year) {
+                            store_i32(out.iso_year + i, _mm_cvttpd_epi32(ty));
+                        }
+                    }
+                    if (out.quarter) {
+                        store_u8(out.quarter + i, _mm_cvttpd_epi32(fdiv(_mm_add_pd(m, _mm_set1_pd(2)), 3)));
+                    }
+                    const __m128d after = _mm_cmpge_pd(m, first);
+                    if (out.fiscal_year) {
+                        store_i32(out.fiscal_year + i, _mm_cvttpd_epi32(_mm_add_pd(y, _mm_and_pd(after, next_year))));
+                    }
+                    if (out.fiscal_period) {
+                        const __m128d period = _mm_add_pd(_mm_sub_pd(m, first),
+                                                          _mm_add_pd(one, _mm_andnot_pd(after, _mm_set1_pd(12))));
+                        store_u8(out.fiscal_period + i, _mm_cvttpd_epi32(period));
+                    }
+                }
+                return i;
+            }
+
+            PROJECT_DATE_TARGET("sse4.1")
+            std::size_t bucket_ids(const std::int32_t* s, std::uint16_t* out, std::size_t count, Bucket bucket) noexcept {
+                std::size_t i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    const __m128i serials = load2(s + i);
+                    __m128d value;
+                    if (bucket == Bucket::weekday) {
+                        value = fmod(_mm_cvtepi32_pd(serials), 7);
+                    } else {
+                        __m128d d, m, y, doy;
+                        if (bucket == Bucket::iso_week) {
+                            const __m128d v = _mm_cvtepi32_pd(serials);
+                            const __m128d iso_day = fmod(_mm_add_pd(v, _mm_set1_pd(6)), 7);
+                            civil(_mm_cvttpd_epi32(_mm_add_pd(_mm_sub_pd(v, iso_day), _mm_set1_pd(3))), d, m, y, doy);
+                        } else {
+                            civil(serials, d, m, y, doy);
+                        }
+                        switch (bucket) {
+                            case Bucket::month:    value = m; break;
+                            case Bucket::quarter:  value = fdiv(_mm_add_pd(m, _mm_set1_pd(2)), 3); break;
+                            case Bucket::iso_week:
+                                value = _mm_add_pd(fdiv(_mm_sub_pd(year_day(m, y, doy), _mm_set1_pd(1)), 7), _mm_set1_pd(1));
+                                break;
+                            case Bucket::year_day: value = year_day(m, y, doy); break;
+                            default:               value = y; break;
+                        }
+                    }
+                    const __m128i v = _mm_cvttpd_epi32(value);
+                    const int packed = _mm_cvtsi128_si32(_mm_packus_epi32(v, v));
+                    std::memcpy(out + i, &packed, 4);
+                }
+                return i;
+            }
+        }
+#endif
+    }
+
+// Seçilen SIMD yolu dizinin başını işler ve işlediği eleman sayısını
+// döndürür; kalan kuyruk skaler döngüye kalır.
+#if PROJECT_DATE_X86_DISPATCH
+#define PROJECT_DATE_DISPATCH(i, kernel, ...)                        \
+    switch (simd::active_level()) {                                  \
+        case simd::Level::avx2:  i = avx2::kernel(__VA_ARGS__); break;  \
+        case simd::Level::sse41: i = sse41::kernel(__VA_ARGS__); break; \
+        default: break;                                              \
+    }
+#else
+#define PROJECT_DATE_DISPATCH(i, kernel, ...)
+#endif
+
+    void add_days(const std::int32_t* serials, std::int32_t n, std::int32_t* out, std::size_t count) noexcept {
+        std::size_t i = 0;
+        PROJECT_DATE_DISPATCH(i, add_days, serials, n, out, count)
+        for (; i < count; ++i) {
+            out[i] = serials[i] + n;
+        }
+    }
+
+    void add_days(const std::int32_t* serials, const std::int32_t* n, std::int32_t* out, std::size_t count) noexcept {
+        std::size_t i = 0;
+        PROJECT_DATE_DISPATCH(i, add_days, serials, n, out, count)
+        for (; i < count; ++i) {
+            out[i] = serials[i] + n[i];
+        }
+    }
+
+    void diff_days(const std::int32_t* d1, const std::int32_t* d2, std::int32_t* out, std::size_t count) noexcept {
+        std::size_t i = 0;
+        PROJECT_DATE_DISPATCH(i, diff_days, d1, d2, out, count)
+        for (; i < count; ++i) {
+            out[i] = d1[i] - d2[i];
+        }
+    }
+
+    void week_days(const std::int32_t* serials, std::uint8_t* out, std::size_t count) noexcept {
+        std::size_t i = 0;
+        PROJECT_DATE_DISPATCH(i, week_days, serials, out, count)
+        for (; i < count; ++i) {
+            out[i] = static_cast<std::uint8_t>(week_day(serials[i]));
+        }
+    }
+
+    void year_days(const std::int32_t* serials, std::uint16_t* out, std::size_t count) noexcept {
+        std::size_t i = 0;
+        PROJECT_DATE_DISPATCH(i, year_days, serials, out, count)
+        for (; i < count; ++i) {
+            out[i] = static_cast<std::uint16_t>(year_day(serials[i]));
+        }
+    }
+
+    void leap_flags(const std::int32_t* serials, std::uint8_t* out, std::size_t count) noexcept {
+        std::size_t i = 0;
+        PROJECT_DATE_DISPATCH(i, leap_flags, serials, out, count)
+        for (; i < count; ++i) {
+            out[i] = civil::is_leap(civil::civil_from_days(serials[i]).year);
+        }
+    }
+
+    void to_serials(const std::int32_t* days, const std::int32_t* months, const std::int32_t* years,
+                    std::int32_t* out, std::size_t count) noexcept {
+        std::size_t i = 0;
+        PROJECT_DATE_DISPATCH(i, to_serials, days, months, years, out, count)
+        for (; i < count; ++i) {
+            out[i] = civil::days_from_civil(days[i], months[i], years[i]);
+        }
+    }
+
+    void from_serials(const std::int32_t* serials, std::int32_t* days, std::int32_t* months,
+                      std::int32_t* years, std::size_t count) noexcept {
+        std::size_t i = 0;
+        PROJECT_DATE_DISPATCH(i, from_serials, serials, days, months, years, count)
+        for (; i < count; ++i) {
+            const civil::CivilDate c = civil::civil_from_days(serials[i]);
+            days[i] = c.day;
+            months[i] = c.month;
+            years[i] = c.year;
+        }
+    }
+
+    void leap_flags_from_years(const std::int32_t* years, std::uint8_t* out, std::size_t count) noexcept {
+        std::size_t i = 0;
+        PROJECT_DATE_DISPATCH(i, leap_flags_from_years, years, out, count)
+        for (; i < count; ++i) {
+            out[i] = civil::is_leap(years[i]);
+        }
+    }
+
+    void calendar_columns(const std::int32_t* serials, const CalendarColumns& out, std::size_t count,
+                          int fiscal_first_month) noexcept {
+        std::size_t i = 0;
+        PROJECT_DATE_DISPATCH(i, calendar_columns, serials, out, count, fiscal_first_month)
+        for (; i < count; ++i) {
+            const civil::CivilDate c = civil::civil_from_days(serials[i]);
+            if (out.iso_week || out.iso_year) {
+                const civil::IsoWeek w = civil::iso_week(serials[i]);
+                if (out.iso_week) {
+                    out.iso_week[i] = static_cast<std::uint8_t>(w.week);
+                }
+                if (out.iso_year) {
+                    out.iso_year[i] = w.year;
+                }
+            }
+            if (out.quarter) {
+                out.quarter[i] = static_cast<std::uint8_t>(civil::quarter(c.month));
+            }
+            if (out.fiscal_year) {
+                out.fiscal_year[i] = civil::fiscal_year(c.month, c.year, fiscal_first_month);
+            }
+            if (out.fiscal_period) {
+                out.fiscal_period[i] = static_cast<std::uint8_t>(civil::fiscal_period(c.month, fiscal_first_month));
+            }
+        }
+    }
+
+    void iso_weeks(const std::int32_t* serials, std::uint8_t* out, std::size_t count) noexcept {
+        CalendarColumns columns;
+        columns.iso_week = out;
+        calendar_columns(serials, columns, count);
+    }
+
+    void quarters(const std::int32_t* serials, std::uint8_t* out, std::size_t count) noexcept {
+        CalendarColumns columns;
+        columns.quarter = out;
+        calendar_columns(serials, columns, count);
+    }
+
+    void bucket_ids(const std::int32_t* serials, std::uint16_t* out, std::size_t count, Bucket bucket) noexcept {
+        std::size_t i = 0;
+        PROJECT_DATE_DISPATCH(i, bucket_ids, serials, out, count, bucket)
+        for (; i < count; ++i) {
+            const int serial = serials[i];
+            int value;
+            switch (bucket) {
+                case Bucket::weekday:  value = week_day(serial); break;
+                case Bucket::month:    value = civil::civil_from_days(serial).month; break;
+                case Bucket::quarter:  value = civil::quarter(civil::civil_from_days(serial).month); break;
+                case Bucket::iso_week: value = civil::iso_week(serial).week; break;
+                case Bucket::year_day: value = year_day(serial); break;
+                default:               value = std::clamp(civil::civil_from_days(serial).year, 0, 0xFFFF); break;
+            }
+            out[i] = static_cast<std::uint16_t>(value);
+        }
+    }
+
+#undef PROJECT_DATE_DISPATCH
+}
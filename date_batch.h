@@ -0,0 +1,64 @@
+#ifndef DATE_BATCH_H
+#define DATE_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include "date_simd.h"
+
+// Gün seri numarası (SerialDate::serial) veya ayrı gün/ay/yıl dizileri
+// üzerinde çalışan toplu çekirdekler. x86'da AVX2 ya da SSE4.1 yolu çalışma
+// anında seçilir (simd::active_level), aksi halde skaler döngü kullanılır.
+// Giriş ve çıkış dizileri aynı dizi olabilir; bunun dışında örtüşmemelidir.
+
+namespace project::batch {
+
+    // Serial columns
+    void add_days(const std::int32_t* serials, std::int32_t n, std::int32_t* out, std::size_t count) noexcept;
+    void add_days(const std::int32_t* serials, const std::int32_t* n, std::int32_t* out, std::size_t count) noexcept;
+    void diff_days(const std::int32_t* d1, const std::int32_t* d2, std::int32_t* out, std::size_t count) noexcept;
+
+    // out: Date::Weekday değerleri (0 = Pazar)
+    void week_days(const std::int32_t* serials, std::uint8_t* out, std::size_t count) noexcept;
+    // out: 1-366
+    void year_days(const std::int32_t* serials, std::uint16_t* out, std::size_t count) noexcept;
+    // out: tarihin yılı artık yılsa 1, değilse 0
+    void leap_flags(const std::int32_t* serials, std::uint8_t* out, std::size_t count) noexcept;
+
+    // Calendar columns: nullptr verilen sütunlar yazılmaz.
+    struct CalendarColumns {
+        std::uint8_t* iso_week = nullptr;        // 1-53
+        std::int32_t* iso_year = nullptr;        // haftanın ISO yılı
+        std::uint8_t* quarter = nullptr;         // 1-4
+        std::int32_t* fiscal_year = nullptr;     // bittiği takvim yılı
+        std::uint8_t* fiscal_period = nullptr;   // 1-12
+    };
+
+    // İstenen tüm sütunları tek geçişte doldurur. Mali yıl
+    // fiscal_first_month ayında (1-12) başlar.
+    void calendar_columns(const std::int32_t* serials, const CalendarColumns& out, std::size_t count,
+                          int fiscal_first_month = 1) noexcept;
+    void iso_weeks(const std::int32_t* serials, std::uint8_t* out, std::size_t count) noexcept;
+    void quarters(const std::int32_t* serials, std::uint8_t* out, std::size_t count) noexcept;
+
+    // Bucket columns
+    enum class Bucket : std::uint8_t {
+        weekday,    // 0-6 (0 = Pazar)
+        month,      // 1-12
+        quarter,    // 1-4
+        iso_week,   // 1-53
+        year_day,   // 1-366
+        year        // takvim yılı (0-65535 aralığına doyurulur; tam yıl için from_serials)
+    };
+
+    // out[i]: serials[i]'nin bucket değeri
+    void bucket_ids(const std::int32_t* serials, std::uint16_t* out, std::size_t count, Bucket bucket) noexcept;
+
+    // SoA columns
+    void to_serials(const std::int32_t* days, const std::int32_t* months, const std::int32_t* years,
+                    std::int32_t* out, std::size_t count) noexcept;
+    void from_serials(const std::int32_t* serials, std::int32_t* days, std::int32_t* months,
+                      std::int32_t* years, std::size_t count) noexcept;
+    void leap_flags_from_years(const std::int32_t* years, std::uint8_t* out, std::size_t count) noexcept;
+}
+
+#endif
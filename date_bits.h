@@ -0,0 +1,65 @@
+#ifndef DATE_BITS_H
+#define DATE_BITS_H
+
+// Gün bit kümelerinin (takvim, tarih kümesi) paylaştığı 64 bitlik kelime
+// yardımcıları. GCC/Clang/MSVC yerleşikleri kullanılır.
+
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace project::bits {
+
+    inline int popcount(std::uint64_t x) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return static_cast<int>(__popcnt64(x));
+#else
+        return __builtin_popcountll(x);
+#endif
+    }
+
+    // x != 0 olmalıdır.
+    inline int countr_zero(std::uint64_t x) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward64(&index, x);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(x);
+#endif
+    }
+
+    // [0, n) aralığındaki bitler; n 0..64 olabilir.
+    constexpr std::uint64_t low_mask(int n) noexcept {
+        return n >= 64 ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << n) - 1;
+    }
+
+    // x içindeki k. (0 tabanlı) bir bitin konumu; k < popcount(x) olmalıdır.
+    inline int select(std::uint64_t x, int k) noexcept {
+#if defined(__BMI2__)
+        return countr_zero(_pdep_u64(std::uint64_t{ 1 } << k, x));
+#else
+        int base = 0;
+        for (;;) {
+            const int n = popcount(x & 0xFF);
+            if (k < n) {
+                break;
+            }
+            k -= n;
+            x >>= 8;
+            base += 8;
+        }
+        while (k-- > 0) {
+            x &= x - 1;
+        }
+        return base + countr_zero(x);
+#endif
+    }
+}
+
+#endif
@@ -0,0 +1,174 @@
+#include "date_calendar.h"
+#include "date_bits.h"
+#include "date_parse.h"
+#include <fstream>
+
+namespace project {
+
+    // Constructors
+    BusinessCalendar::BusinessCalendar(int first_year, int last_year, WeekendMask weekend)
+        : m_first_year(first_year), m_last_year(last_year), m_weekend(weekend) {
+        if (first_year < Date::year_base) {
+            throw InvalidYearException(first_year, Date::year_base);
+        }
+        if (last_year < first_year) {
+            throw InvalidYearException(last_year, first_year);
+        }
+        if (last_year > Date::max_year) {
+            throw InvalidYearException(last_year, Date::year_base);
+        }
+        m_first = civil::days_from_civil(1, 1, first_year);
+        const long long days = static_cast<long long>(civil::days_from_civil(31, 12, last_year)) + 1 - m_first;
+        m_days = static_cast<int>(days);
+        m_bits.assign((static_cast<std::size_t>(m_days) + 63) / 64, 0);
+
+        // Haftanın günü deseni: ilk günden başlayarak 7 günlük döngü
+        int weekday = (m_first % 7 + 7) % 7;
+        for (int i = 0; i < m_days; ++i) {
+            if (!weekend.contains(static_cast<Date::Weekday>(weekday))) {
+                m_bits[i >> 6] |= std::uint64_t{ 1 } << (i & 63);
+            }
+            weekday = weekday == 6 ? 0 : weekday + 1;
+        }
+        rebuild_index();
+    }
+
+    // Holidays
+    void BusinessCalendar::add_holiday(const Date& date) {
+        clear_day(date.get_day_serial());
+        rebuild_index();
+    }
+
+    void BusinessCalendar::add_holidays(const Date* dates, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            clear_day(dates[i].get_day_serial());
+        }
+        rebuild_index();
+    }
+
+    std::size_t BusinessCalendar::load_holidays(const std::string& path) {
+        std::ifstream in(path);
+        if (!in) {
+            throw DateException("Tatil dosyasi acilamadi: " + path);
+        }
+
+        std::size_t marked = 0;
+        std::string line;
+        while (std::getline(in, line)) {
+            std::size_t pos = line.find_first_not_of(" \t\r");
+            if (pos == std::string::npos || line[pos] == '#') {
+                continue;
+            }
+
+            const std::string_view text(line.data() + pos, line.size() - pos);
+            Date date;
+            const DateParseResult r = parse_date(text, date);
+            if (r.ec != DateErrc::ok) {
+                throw InvalidDateFormatException(line);
+            }
+            // Tarihten sonra yalnızca boşluk ya da açıklama gelebilir
+            const std::size_t tail = line.find_first_not_of(" \t\r", pos + (r.ptr - text.data()));
+            if (tail != std::string::npos && line[tail] != '#') {
+                throw InvalidDateFormatException(line);
+            }
+
+            if (contains(date)) {
+                clear_day(date.get_day_serial());
+                ++marked;
+            }
+        }
+        rebuild_index();
+        return marked;
+    }
+
+    // Queries
+    bool BusinessCalendar::contains(const Date& date) const noexcept {
+        const int index = date.get_day_serial() - m_first;
+        return index >= 0 && index < m_days;
+    }
+
+    bool BusinessCalendar::is_business_day(const Date& date) const {
+        return is_business_day(SerialDate(date));
+    }
+
+    bool BusinessCalendar::is_business_day(SerialDate date) const {
+        const int index = index_of(date, m_days - 1);
+        return (m_bits[index >> 6] >> (index & 63)) & 1u;
+    }
+
+    int BusinessCalendar::business_days_between(const Date& from, const Date& to) const {
+        return business_days_between(SerialDate(from), SerialDate(to));
+    }
+
+    int BusinessCalendar::business_days_between(SerialDate from, SerialDate to) const {
+        // Uç nokta olarak pencerenin bir gün sonrası da kabul edilir
+        return rank(index_of(to, m_days)) - rank(index_of(from, m_days));
+    }
+
+    Date BusinessCalendar::add_business_days(const Date& date, int n) const {
+        return add_business_days(SerialDate(date), n).to_date();
+    }
+
+    SerialDate BusinessCalendar::add_business_days(SerialDate date, int n) const {
+        const int index = index_of(date, m_days - 1);
+        if (n == 0) {
+            return date;
+        }
+
+        // Hedef, pencere içindeki iş günleri arasındaki sırasıdır
+        const long long k = n > 0
+            ? static_cast<long long>(rank(index + 1)) + n - 1
+            : static_cast<long long>(rank(index)) + n;
+        if (k < 0 || k >= business_day_count()) {
+            throw DateException("Is gunu sonucu takvim araligi disinda");
+        }
+        return SerialDate::from_serial(m_first + select(static_cast<int>(k)));
+    }
+
+    // Helper functions
+    int BusinessCalendar::index_of(SerialDate date, int limit) const {
+        const long long index = static_cast<long long>(date.serial()) - m_first;
+        if (index < 0 || index > limit) {
+            throw DateException("Tarih takvim araligi disinda");
+        }
+        return static_cast<int>(index);
+    }
+
+    int BusinessCalendar::rank(int index) const noexcept {
+        const int word = index >> 6;
+        const int bit = index & 63;
+        return bit == 0 ? m_rank[word]
+                        : m_rank[word] + bits::popcount(m_bits[word] & bits::low_mask(bit));
+    }
+
+    int BusinessCalendar::select(int k) const noexcept {
+        std::size_t word = static_cast<std::size_t>(m_select[static_cast<std::size_t>(k) >> 6]);
+        while (m_rank[word + 1] <= k) {
+            ++word;
+        }
+        return static_cast<int>(word) * 64 + bits::select(m_bits[word], k - m_rank[word]);
+    }
+
+    void BusinessCalendar::clear_day(int serial) noexcept {
+        const int index = serial - m_first;
+        if (index >= 0 && index < m_days) {
+            m_bits[index >> 6] &= ~(std::uint64_t{ 1 } << (index & 63));
+        }
+    }
+
+    void BusinessCalendar::rebuild_index() {
+        m_rank.assign(m_bits.size() + 1, 0);
+        m_select.clear();
+        int total = 0;
+        for (std::size_t w = 0; w < m_bits.size(); ++w) {
+            m_rank[w] = total;
+            const int count = bits::popcount(m_bits[w]);
+            // Bu kelimede başlayan her 64'ün katı iş günü için bir örnek
+            while (static_cast<int>(m_select.size()) * 64 < total + count) {
+                m_select.push_back(static_cast<int>(w));
+            }
+            total += count;
+        }
+        m_rank.back() = total;
+    }
+}
@@ -0,0 +1,92 @@
+#ifndef DATE_CALENDAR_H
+#define DATE_CALENDAR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+#include "date.h"
+#include "serial_date.h"
+
+namespace project {
+    // Hafta sonu sayılan günler; bit i, Weekday değeri i olan gündür.
+    class WeekendMask {
+    public:
+        constexpr WeekendMask() noexcept = default;
+        constexpr WeekendMask(std::initializer_list<Date::Weekday> days) noexcept {
+            for (const Date::Weekday day : days) {
+                m_bits = static_cast<std::uint8_t>(m_bits | (1u << static_cast<int>(day)));
+            }
+        }
+
+        [[nodiscard]] constexpr bool contains(Date::Weekday day) const noexcept {
+            return (m_bits >> static_cast<int>(day)) & 1u;
+        }
+        [[nodiscard]] constexpr std::uint8_t bits() const noexcept { return m_bits; }
+
+    private:
+        std::uint8_t m_bits = 0;
+    };
+
+    inline constexpr WeekendMask saturday_sunday{ Date::Weekday::Saturday, Date::Weekday::Sunday };
+
+    // [first_year, last_year] penceresindeki her gün için bir bitlik iş günü
+    // kümesi. Her 64 günlük kelime için önceki iş günü sayısı (rank) ve her
+    // 64 iş gününün düştüğü kelime (select örneği) tutulur; böylece sayma ve
+    // ileri/geri iş günü ekleme döngüsüz, sabit zamanlı aramalara dönüşür.
+    // Tatil ekleme indeksleri yeniden kurar; sorgular const ve iş parçacığı
+    // güvenlidir. Pencere dışındaki tarihler ve açılamayan tatil dosyaları
+    // DateException fırlatır.
+    class BusinessCalendar {
+    public:
+        // year_base <= first_year <= last_year <= Date::max_year değilse
+        // InvalidYearException fırlatır.
+        BusinessCalendar(int first_year, int last_year, WeekendMask weekend = saturday_sunday);
+
+        // Holidays
+        void add_holiday(const Date& date);
+        void add_holidays(const Date* dates, std::size_t count);
+        // Her satırda bir tarih (ayrıştırıcının kabul ettiği biçimlerde);
+        // boş satırlar ve '#' ile başlayan açıklamalar atlanır. Pencere
+        // içindeki işaretlenen tatil sayısını döndürür.
+        std::size_t load_holidays(const std::string& path);
+
+        // Queries
+        [[nodiscard]] bool contains(const Date& date) const noexcept;
+        [[nodiscard]] bool is_business_day(const Date& date) const;
+        [[nodiscard]] bool is_business_day(SerialDate date) const;
+
+        // [from, to) aralığındaki iş günü sayısı; to < from ise negatif.
+        [[nodiscard]] int business_days_between(const Date& from, const Date& to) const;
+        [[nodiscard]] int business_days_between(SerialDate from, SerialDate to) const;
+
+        // n > 0: date'ten sonraki n. iş günü, n < 0: önceki |n|. iş günü,
+        // n == 0: date'in kendisi.
+        [[nodiscard]] Date add_business_days(const Date& date, int n) const;
+        [[nodiscard]] SerialDate add_business_days(SerialDate date, int n) const;
+
+        [[nodiscard]] int first_year() const noexcept { return m_first_year; }
+        [[nodiscard]] int last_year() const noexcept { return m_last_year; }
+        [[nodiscard]] WeekendMask weekend() const noexcept { return m_weekend; }
+        [[nodiscard]] int business_day_count() const noexcept { return m_rank.back(); }
+
+    private:
+        [[nodiscard]] int index_of(SerialDate date, int limit) const;
+        [[nodiscard]] int rank(int index) const noexcept;
+        [[nodiscard]] int select(int k) const noexcept;
+        void clear_day(int serial) noexcept;
+        void rebuild_index();
+
+        int m_first_year;
+        int m_last_year;
+        WeekendMask m_weekend;
+        int m_first;   // pencerenin ilk gün seri numarası
+        int m_days;
+        std::vector<std::uint64_t> m_bits;
+        std::vector<int> m_rank;     // m_bits.size() + 1 eleman
+        std::vector<int> m_select;   // k. örnek: (k * 64). iş gününün kelimesi
+    };
+}
+
+#endif
@@ -0,0 +1,177 @@
+#ifndef DATE_CIVIL_H
+#define DATE_CIVIL_H
+
+// Gün seri numarası <-> takvim tarihi dönüşüm motoru.
+// Seri numarası Rata Die sayımıdır: 01/01/0001 = 1. Algoritmalar
+// döngüsüzdür ve sabit zamanda çalışır. civil_from_days dallanmasızdır;
+// days_from_civil ve year_day yılın tablo penceresinde olup olmamasına
+// göre tek bir dal içerir (pencere içinde tablo, dışında formül).
+
+#include <cstdint>
+
+namespace project::civil {
+
+    struct CivilDate {
+        int day;
+        int month;
+        int year;
+    };
+
+    [[nodiscard]] constexpr bool is_leap(int y) noexcept {
+        return (y % 4 == 0 && y % 100 != 0) || (y % 400 == 0);
+    }
+
+    inline constexpr int month_days[2][12] = {
+        {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31},
+        {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31}
+    };
+
+    [[nodiscard]] constexpr int days_in_month(int month, int year) noexcept {
+        return month_days[is_leap(year)][month - 1];
+    }
+
+    // Gregoryen takvim 400 yıllık (146097 günlük) periyotlarla tekrar eder.
+    // Hesaplar yılı 1 Mart'tan başlatır; böylece Şubat yılın son ayı olur
+    // ve artık gün formüllere ek bir dal gerektirmeden girer.
+    [[nodiscard]] constexpr int days_from_civil_formula(int day, int month, int year) noexcept {
+        const int y = year - (month <= 2);
+        const int era = (y >= 0 ? y : y - 399) / 400;
+        const unsigned yoe = static_cast<unsigned>(y - era * 400);                 // [0, 399]
+        const unsigned mp = static_cast<unsigned>(month > 2 ? month - 3 : month + 9); // [0, 11]
+        const unsigned doy = (153 * mp + 2) / 5 + static_cast<unsigned>(day) - 1;   // [0, 365]
+        const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;                 // [0, 146096]
+        return era * 146097 + static_cast<int>(doe) - 305;
+    }
+
+    // Lookup tables
+    // Ay başından önceki gün sayıları [artık][ay - 1]; 52 bayt.
+    struct CumulativeDays {
+        std::int16_t days[2][13];
+    };
+
+    constexpr CumulativeDays make_cumulative_days() noexcept {
+        CumulativeDays table{};
+        for (int leap = 0; leap < 2; ++leap) {
+            for (int m = 0; m < 12; ++m) {
+                table.days[leap][m + 1] = static_cast<std::int16_t>(table.days[leap][m] + month_days[leap][m]);
+            }
+        }
+        return table;
+    }
+
+    inline constexpr CumulativeDays cumulative_days = make_cumulative_days();
+
+    // [FirstYear, LastYear] penceresindeki her yıl için önceki yılın son
+    // gününün seri numarası ve artık yıl bayrağı tek int32 içinde tutulur:
+    // entry = seri * 2 + artık. Kullanılan pencere 256 yıl, 1 KB.
+    template<int FirstYear, int LastYear>
+    class YearStartTable {
+    public:
+        static_assert(FirstYear <= LastYear);
+        static constexpr int first_year = FirstYear;
+        static constexpr int last_year = LastYear;
+
+        constexpr YearStartTable() noexcept : m_entries{} {
+            for (int y = FirstYear; y <= LastYear; ++y) {
+                m_entries[y - FirstYear] = days_from_civil_formula(0, 1, y) * 2 + is_leap(y);
+            }
+        }
+
+        [[nodiscard]] constexpr bool contains(int year) const noexcept {
+            return static_cast<unsigned>(year - FirstYear) <= static_cast<unsigned>(LastYear - FirstYear);
+        }
+
+        // Ön koşul: contains(year)
+        [[nodiscard]] constexpr int start(int year) const noexcept {
+            return m_entries[year - FirstYear] >> 1;
+        }
+
+        [[nodiscard]] constexpr bool leap(int year) const noexcept {
+            return m_entries[year - FirstYear] & 1;
+        }
+
+    private:
+        std::int32_t m_entries[LastYear - FirstYear + 1];
+    };
+
+    // Yıl başı tablosunun penceresi. Sabittir: inline değişken tüm çeviri
+    // birimlerinde aynı tanıma sahip olmalıdır (ODR).
+    inline constexpr int year_table_first = 1900;
+    inline constexpr int year_table_last = 2155;
+
+    inline constexpr YearStartTable<year_table_first, year_table_last> year_starts{};
+
+    // 1-366; ön koşul: 1 <= month <= 12
+    [[nodiscard]] constexpr int year_day(int day, int month, int year) noexcept {
+        const bool leap = year_starts.contains(year) ? year_starts.leap(year) : is_leap(year);
+        return cumulative_days.days[leap][month - 1] + day;
+    }
+
+    // Pencere içindeki yıllarda tek tablo okuması, dışında formül kullanılır.
+    // Ön koşul: 1 <= month <= 12
+    [[nodiscard]] constexpr int days_from_civil(int day, int month, int year) noexcept {
+        if (year_starts.contains(year)) {
+            return year_starts.start(year) + cumulative_days.days[year_starts.leap(year)][month - 1] + day;
+        }
+        return days_from_civil_formula(day, month, year);
+    }
+
+    [[nodiscard]] constexpr CivilDate civil_from_days(int days) noexcept {
+        const int z = days + 305;
+        const int era = (z >= 0 ? z : z - 146096) / 146097;
+        const unsigned doe = static_cast<unsigned>(z - era * 146097);                     // [0, 146096]
+        const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;       // [0, 399]
+        const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);                     // [0, 365]
+        const unsigned mp = (5 * doy + 2) / 153;                                          // [0, 11]
+        const unsigned d = doy - (153 * mp + 2) / 5 + 1;                                  // [1, 31]
+        const unsigned m = mp < 10 ? mp + 3 : mp - 9;                                     // [1, 12]
+        const int y = static_cast<int>(yoe) + era * 400 + (m <= 2);
+        return { static_cast<int>(d), static_cast<int>(m), y };
+    }
+
+    // Ay ekleme: gün, hedef ayın uzunluğuna kırpılır (31/01 + 1 ay = 28/02 ya da 29/02).
+    [[nodiscard]] constexpr CivilDate add_months(const CivilDate& c, int months) noexcept {
+        const int index = c.year * 12 + (c.month - 1) + months;
+        const int year = (index >= 0 ? index : index - 11) / 12;
+        const int month = index - year * 12 + 1;
+        const int max_day = days_in_month(month, year);
+        return { c.day < max_day ? c.day : max_day, month, year };
+    }
+
+    struct IsoWeek {
+        int year;   // haftanın ait olduğu ISO yılı
+        int week;   // 1-53
+    };
+
+    // ISO 8601 haftası: hafta Pazartesi başlar ve Perşembesinin düştüğü yıla
+    // aittir; o yılın kaçıncı haftası olduğu Perşembenin yıl içindeki
+    // gününden doğrudan bulunur.
+    [[nodiscard]] constexpr IsoWeek iso_week(int serial) noexcept {
+        const int iso_day = ((serial % 7 + 7) % 7 + 6) % 7;   // Pazartesi = 0
+        const CivilDate thursday = civil_from_days(serial - iso_day + 3);
+        return { thursday.year, (year_day(thursday.day, thursday.month, thursday.year) - 1) / 7 + 1 };
+    }
+
+    [[nodiscard]] constexpr int quarter(int month) noexcept {
+        return (month + 2) / 3;
+    }
+
+    // Mali yıl first_month ayında başlar ve bittiği takvim yılıyla anılır
+    // (Ekim başlangıçlı: 01/10/2023 - 30/09/2024 = 2024). Dönem 1-12.
+    [[nodiscard]] constexpr int fiscal_year(int month, int year, int first_month) noexcept {
+        return first_month != 1 && month >= first_month ? year + 1 : year;
+    }
+
+    [[nodiscard]] constexpr int fiscal_period(int month, int first_month) noexcept {
+        return month >= first_month ? month - first_month + 1 : month - first_month + 13;
+    }
+
+    static_assert(days_from_civil(1, 1, 1) == 1);
+    static_assert(days_from_civil(1, 3, 2024) == days_from_civil_formula(1, 3, 2024));
+    static_assert(days_from_civil(31, 12, 1899) + 1 == days_from_civil(1, 1, 1900));
+    static_assert(civil_from_days(days_from_civil(29, 2, 2000)).day == 29);
+    static_assert(iso_week(days_from_civil(1, 1, 2021)).year == 2020 && iso_week(days_from_civil(1, 1, 2021)).week == 53);
+    static_assert(iso_week(days_from_civil(31, 12, 2024)).year == 2025 && iso_week(days_from_civil(31, 12, 2024)).week == 1);
+}
+
+#endif
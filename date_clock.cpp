@@ -0,0 +1,105 @@
+#include "date_clock.h"
+#include <limits>
+
+namespace project {
+
+    // Helper functions
+    namespace {
+        // Geçişler arasında en az bu kadar süre olduğu varsayılır.
+        constexpr std::time_t transition_horizon = 7 * seconds_per_day;
+
+        long query_offset(std::time_t t) {
+            std::tm tm_local{};
+#ifdef _MSC_VER
+            localtime_s(&tm_local, &t);  // Visual Studio için güvenli versiyon
+#else
+            localtime_r(&t, &tm_local);  // std::localtime'ın aksine iş parçacığı güvenli
+#endif
+            const long long local = static_cast<long long>(
+                civil::days_from_civil(tm_local.tm_mday, tm_local.tm_mon + 1, tm_local.tm_year + 1900) -
+                unix_epoch_serial) * seconds_per_day +
+                tm_local.tm_hour * 3600LL + tm_local.tm_min * 60LL + tm_local.tm_sec;
+            return static_cast<long>(local - static_cast<long long>(t));
+        }
+
+        struct OffsetCache {
+            std::time_t valid_from = 1;
+            std::time_t valid_until = 0;   // boş: [1, 0)
+            long offset = 0;
+        };
+
+        thread_local OffsetCache offset_cache;
+
+        struct TodayCache {
+            std::time_t valid_until = std::numeric_limits<std::time_t>::min();
+            Date date;
+        };
+
+        thread_local TodayCache today_cache;
+        thread_local TodayCache today_utc_cache;
+
+        // [t, sonuç) aralığında fark sabittir.
+        std::time_t next_transition(std::time_t t, long offset) {
+            std::time_t lo = t;
+            std::time_t hi = t + transition_horizon;
+            if (query_offset(hi) == offset) {
+                return hi;
+            }
+            // lo'da eski fark, hi'da yeni fark: ilk farklı saniyeyi ara
+            while (hi - lo > 1) {
+                const std::time_t mid = lo + (hi - lo) / 2;
+                if (query_offset(mid) == offset) {
+                    lo = mid;
+                } else {
+                    hi = mid;
+                }
+            }
+            return hi;
+        }
+
+        std::time_t next_midnight_utc(std::time_t t) noexcept {
+            return static_cast<std::time_t>(
+                (static_cast<long long>(utc_serial(t).serial()) - unix_epoch_serial + 1) * seconds_per_day);
+        }
+    }
+
+    long utc_offset(std::time_t t) {
+        OffsetCache& cache = offset_cache;
+        if (t >= cache.valid_from && t < cache.valid_until) {
+            return cache.offset;
+        }
+        const long offset = query_offset(t);
+        cache.valid_from = t;
+        cache.valid_until = next_transition(t, offset);
+        cache.offset = offset;
+        return offset;
+    }
+
+    Date local_date(std::time_t t) {
+        return utc_date(t + utc_offset(t));
+    }
+
+    Date today() {
+        const std::time_t now = std::time(nullptr);
+        TodayCache& cache = today_cache;
+        if (now < cache.valid_until) {
+            return cache.date;
+        }
+        const long offset = utc_offset(now);
+        cache.date = utc_date(now + offset);
+        // Yerel gece yarısı ya da saat dilimi geçişi, hangisi önceyse
+        const std::time_t midnight = next_midnight_utc(now + offset) - offset;
+        cache.valid_until = midnight < offset_cache.valid_until ? midnight : offset_cache.valid_until;
+        return cache.date;
+    }
+
+    Date today_utc() noexcept {
+        const std::time_t now = std::time(nullptr);
+        TodayCache& cache = today_utc_cache;
+        if (now >= cache.valid_until) {
+            cache.date = utc_date(now);
+            cache.valid_until = next_midnight_utc(now);
+        }
+        return cache.date;
+    }
+}
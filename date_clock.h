@@ -0,0 +1,37 @@
+#ifndef DATE_CLOCK_H
+#define DATE_CLOCK_H
+
+#include <ctime>
+#include "date.h"
+#include "serial_date.h"
+
+namespace project {
+    inline constexpr int unix_epoch_serial = civil::days_from_civil(1, 1, 1970);
+    inline constexpr long seconds_per_day = 86400;
+
+    // UTC: yalnızca tamsayı aritmetiği, kilit ya da saat dilimi araması yok.
+    [[nodiscard]] constexpr SerialDate utc_serial(std::time_t t) noexcept {
+        const long long s = static_cast<long long>(t);
+        const long long days = (s >= 0 ? s : s - (seconds_per_day - 1)) / seconds_per_day;
+        return SerialDate::from_serial(static_cast<SerialDate::rep>(days + unix_epoch_serial));
+    }
+
+    [[nodiscard]] constexpr Date utc_date(std::time_t t) noexcept {
+        return Date::from_day_serial(utc_serial(t).serial());
+    }
+
+    // Yerel saat diliminin t anındaki UTC farkı (saniye). Sonuç, bir sonraki
+    // geçişe (yaz saati vb.) kadar iş parçacığı başına önbellekte tutulur;
+    // böylece localtime çağrısı yalnızca geçişlerde ve önbellek ıskalarında
+    // yapılır. Çalışma sırasında TZ değiştirilirse önbellek bunu görmez.
+    [[nodiscard]] long utc_offset(std::time_t t);
+
+    [[nodiscard]] Date local_date(std::time_t t);
+
+    // Bugünün tarihi. İş parçacığı başına saklanır ve yalnızca gün sınırı
+    // (ya da saat dilimi geçişi) aşıldığında yeniden hesaplanır.
+    [[nodiscard]] Date today();
+    [[nodiscard]] Date today_utc() noexcept;
+}
+
+#endif
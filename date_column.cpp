@@ -0,0 +1,240 @@
+#include "date_column.h"
+#include "date_parallel.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace project {
+
+    // Helper functions
+    namespace {
+        int bit_width(std::uint32_t x) noexcept {
+            int width = 0;
+            while (x != 0) {
+                ++width;
+                x >>= 1;
+            }
+            return width;
+        }
+
+        // Veri baytı + hizalı okumalar için 8 bayt boşluk
+        std::uint64_t payload_bytes(std::uint32_t rows, std::uint32_t width) noexcept {
+            return (static_cast<std::uint64_t>(rows) * width + 63) / 64 * 8 + 8;
+        }
+
+        // Argümanlar doğrulanmadan dosya açılmaz: trunc var olan içeriği siler
+        std::ofstream open_output(const std::string& path, std::uint32_t block_rows) {
+            if (block_rows == 0) {
+                throw std::invalid_argument("Blok satir sayisi sifir olamaz");
+            }
+            return std::ofstream(path, std::ios::binary | std::ios::trunc);
+        }
+
+        void unpack(const char* data, std::uint32_t rows, std::uint32_t width,
+                    std::int32_t min, SerialDate* out) noexcept {
+            if (width == 0) {
+                for (std::uint32_t i = 0; i < rows; ++i) {
+                    out[i] = SerialDate::from_serial(min);
+                }
+                return;
+            }
+            // width <= 32: her değer, baytına hizalı tek 64 bitlik okumaya sığar
+            const std::uint64_t mask = (std::uint64_t{ 1 } << width) - 1;
+            std::uint64_t bit = 0;
+            for (std::uint32_t i = 0; i < rows; ++i, bit += width) {
+                std::uint64_t word;
+                std::memcpy(&word, data + (bit >> 3), sizeof(word));
+                // Bozuk bir blokta min + değer int32'yi aşabilir; toplama işaretsiz yapılır
+                const std::uint32_t value = static_cast<std::uint32_t>(min) + static_cast<std::uint32_t>((word >> (bit & 7)) & mask);
+                out[i] = SerialDate::from_serial(static_cast<std::int32_t>(value));
+            }
+        }
+    }
+
+    // Writer
+    DateColumnWriter::DateColumnWriter(const std::string& path, std::uint32_t block_rows)
+        : m_out(open_output(path, block_rows)), m_path(path), m_block_rows(block_rows) {
+        if (!m_out) {
+            throw std::runtime_error("Dosya acilamadi: " + path);
+        }
+        // Başlık close()'da tamamlanır
+        const column::FileHeader header{};
+        m_out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_pending.reserve(block_rows);
+    }
+
+    DateColumnWriter::~DateColumnWriter() {
+        try {
+            close();
+        } catch (...) {
+        }
+    }
+
+    void DateColumnWriter::append(SerialDate date) {
+        m_pending.push_back(date.serial());
+        if (m_pending.size() == m_block_rows) {
+            flush_block();
+        }
+    }
+
+    void DateColumnWriter::append(const SerialDate* dates, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            append(dates[i]);
+        }
+    }
+
+    void DateColumnWriter::append(const Date* dates, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            append(SerialDate{ dates[i] });
+        }
+    }
+
+    void DateColumnWriter::close() {
+        if (m_closed) {
+            return;
+        }
+        m_closed = true;
+        flush_block();
+
+        column::FileHeader header{};
+        std::memcpy(header.magic, column::magic, sizeof(header.magic));
+        header.version = column::version;
+        header.block_rows = m_block_rows;
+        header.row_count = m_rows;
+        header.directory_offset = m_offset;
+
+        m_out.write(reinterpret_cast<const char*>(m_directory.data()),
+                    static_cast<std::streamsize>(m_directory.size() * sizeof(column::BlockHeader)));
+        m_out.seekp(0);
+        m_out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_out.close();
+        if (!m_out) {
+            throw std::runtime_error("Dosya yazilamadi: " + m_path);
+        }
+    }
+
+    void DateColumnWriter::flush_block() {
+        if (m_pending.empty()) {
+            return;
+        }
+        std::int32_t min = m_pending[0];
+        std::int32_t max = min;
+        for (const std::int32_t s : m_pending) {
+            min = s < min ? s : min;
+            max = s > max ? s : max;
+        }
+
+        const std::uint32_t rows = static_cast<std::uint32_t>(m_pending.size());
+        const std::uint32_t width = static_cast<std::uint32_t>(
+            bit_width(static_cast<std::uint32_t>(max) - static_cast<std::uint32_t>(min)));
+        const std::uint64_t bytes = payload_bytes(rows, width);
+
+        m_packed.assign(bytes / 8, 0);
+        std::uint64_t bit = 0;
+        for (const std::int32_t s : m_pending) {
+            const std::uint64_t v = static_cast<std::uint32_t>(s) - static_cast<std::uint32_t>(min);
+            m_packed[bit >> 6] |= v << (bit & 63);
+            if ((bit & 63) + width > 64) {
+                m_packed[(bit >> 6) + 1] |= v >> (64 - (bit & 63));
+            }
+            bit += width;
+        }
+        m_out.write(reinterpret_cast<const char*>(m_packed.data()), static_cast<std::streamsize>(bytes));
+        if (!m_out) {
+            throw std::runtime_error("Dosya yazilamadi: " + m_path);
+        }
+
+        m_directory.push_back({ min, max, rows, width, m_offset });
+        m_offset += bytes;
+        m_rows += rows;
+        m_pending.clear();
+    }
+
+    // Reader
+    DateColumnReader::DateColumnReader(const std::string& path) : m_file(path) {
+        const auto corrupt = [&path] {
+            return std::runtime_error("Gecersiz tarih sutunu dosyasi: " + path);
+        };
+        column::FileHeader header;
+        if (m_file.size() < sizeof(header)) {
+            throw corrupt();
+        }
+        std::memcpy(&header, m_file.data(), sizeof(header));
+        if (std::memcmp(header.magic, column::magic, sizeof(header.magic)) != 0 ||
+            header.version != column::version || header.directory_offset < sizeof(header) ||
+            header.directory_offset > m_file.size()) {
+            throw corrupt();
+        }
+
+        const std::size_t entries = (m_file.size() - header.directory_offset) / sizeof(column::BlockHeader);
+        m_directory.resize(entries);
+        if (entries != 0) {   // boş sütunda data() boş göstericidir
+            std::memcpy(m_directory.data(), m_file.data() + header.directory_offset,
+                        entries * sizeof(column::BlockHeader));
+        }
+
+        m_first_rows.reserve(entries);
+        for (const column::BlockHeader& b : m_directory) {
+            // offset + payload taşabilir; karşılaştırma farka göre yapılır
+            if (b.min > b.max ||
+                b.width > static_cast<std::uint32_t>(bit_width(static_cast<std::uint32_t>(b.max) - static_cast<std::uint32_t>(b.min))) ||
+                b.offset < sizeof(header) || b.offset > header.directory_offset ||
+                payload_bytes(b.rows, b.width) > header.directory_offset - b.offset) {
+                throw corrupt();
+            }
+            m_first_rows.push_back(m_rows);
+            m_rows += b.rows;
+        }
+        if (m_rows != header.row_count) {
+            throw corrupt();
+        }
+    }
+
+    DateColumnReader::BlockInfo DateColumnReader::block(std::size_t index) const noexcept {
+        const column::BlockHeader& b = m_directory[index];
+        return { SerialDate::from_serial(b.min), SerialDate::from_serial(b.max), b.rows, m_first_rows[index] };
+    }
+
+    bool DateColumnReader::overlaps(std::size_t index, SerialDate first, SerialDate last) const noexcept {
+        const column::BlockHeader& b = m_directory[index];
+        return b.min < last.serial() && b.max >= first.serial();
+    }
+
+    std::size_t DateColumnReader::decode_block(std::size_t index, SerialDate* out) const noexcept {
+        const column::BlockHeader& b = m_directory[index];
+        unpack(m_file.data() + b.offset, b.rows, b.width, b.min, out);
+        return b.rows;
+    }
+
+    void DateColumnReader::read_all(SerialDate* out, unsigned threads) const {
+        m_file.advise_sequential();
+        parallel::for_each_chunk(m_directory.size(), threads, [this, out](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                decode_block(i, out + m_first_rows[i]);
+            }
+        }, 16);
+    }
+
+    std::size_t DateColumnReader::select(SerialDate first, SerialDate last, SerialDate* out) const {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < m_directory.size(); ++i) {
+            if (!overlaps(i, first, last)) {
+                continue;
+            }
+            const column::BlockHeader& b = m_directory[i];
+            // Blok tamamen aralık içindeyse doğrudan çözülür
+            if (b.min >= first.serial() && b.max < last.serial()) {
+                count += decode_block(i, out + count);
+                continue;
+            }
+            const std::size_t n = decode_block(i, out + count);
+            std::size_t kept = 0;
+            for (std::size_t j = 0; j < n; ++j) {
+                const SerialDate s = out[count + j];
+                out[count + kept] = s;
+                kept += (s >= first) & (s < last);
+            }
+            count += kept;
+        }
+        return count;
+    }
+}
@@ -0,0 +1,123 @@
+#ifndef DATE_COLUMN_H
+#define DATE_COLUMN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "date.h"
+#include "date_mmap.h"
+#include "serial_date.h"
+
+// Tarih sütunları için ikili dosya biçimi (küçük endian):
+//
+//   başlık     : "DTCOL1\0\0", sürüm, blok satır sayısı, toplam satır,
+//                dizin ofseti (32 bayt)
+//   bloklar    : blok başına (seri - min) değerleri width bitle paketlenir
+//                (frame-of-reference); her blok 8 baytın katıdır ve sonunda
+//                8 bayt boşluk bırakılır
+//   dizin      : blok başına min, max, satır sayısı, width ve veri ofseti
+//
+// Okuyucu dosyayı eşler ve blokları doğrudan eşlenmiş bellekten çözer;
+// min/max başlıkları aralık sorgularında blok atlamayı sağlar.
+
+namespace project {
+    namespace column {
+        inline constexpr char magic[8] = { 'D', 'T', 'C', 'O', 'L', '1', '\0', '\0' };
+        inline constexpr std::uint32_t version = 1;
+        inline constexpr std::uint32_t default_block_rows = 4096;
+
+        struct FileHeader {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t block_rows;
+            std::uint64_t row_count;
+            std::uint64_t directory_offset;
+        };
+
+        struct BlockHeader {
+            std::int32_t min;
+            std::int32_t max;
+            std::uint32_t rows;
+            std::uint32_t width;
+            std::uint64_t offset;
+        };
+
+        static_assert(sizeof(FileHeader) == 32 && sizeof(BlockHeader) == 24);
+    }
+
+    // Sütunu blok blok yazar; tamamlanmamış son blok ve dizin close()'da
+    // yazılır. Yıkıcı close()'u çağırır, ancak hataları yalnızca açık
+    // close() çağrısı bildirir (std::runtime_error).
+    class DateColumnWriter {
+    public:
+        explicit DateColumnWriter(const std::string& path,
+                                  std::uint32_t block_rows = column::default_block_rows);
+        ~DateColumnWriter();
+
+        DateColumnWriter(const DateColumnWriter&) = delete;
+        DateColumnWriter& operator=(const DateColumnWriter&) = delete;
+
+        void append(SerialDate date);
+        void append(const SerialDate* dates, std::size_t count);
+        void append(const Date* dates, std::size_t count);
+        void close();
+
+        [[nodiscard]] std::uint64_t rows() const noexcept { return m_rows; }
+
+    private:
+        void flush_block();
+
+        std::ofstream m_out;
+        std::string m_path;
+        std::uint32_t m_block_rows;
+        std::uint64_t m_rows = 0;
+        std::uint64_t m_offset = sizeof(column::FileHeader);
+        std::vector<SerialDate::rep> m_pending;
+        std::vector<std::uint64_t> m_packed;
+        std::vector<column::BlockHeader> m_directory;
+        bool m_closed = false;
+    };
+
+    // Eşlenmiş sütun dosyası üzerinde sıfır kopyalı okuyucu. Bozuk ya da
+    // uyumsuz dosyalar açılışta std::runtime_error fırlatır. Okuma
+    // fonksiyonları const'tur ve iş parçacıkları arasında paylaşılabilir.
+    class DateColumnReader {
+    public:
+        struct BlockInfo {
+            SerialDate min;
+            SerialDate max;
+            std::uint32_t rows;
+            std::uint64_t first_row;
+        };
+
+        explicit DateColumnReader(const std::string& path);
+
+        [[nodiscard]] std::uint64_t rows() const noexcept { return m_rows; }
+        [[nodiscard]] std::size_t block_count() const noexcept { return m_directory.size(); }
+        [[nodiscard]] BlockInfo block(std::size_t index) const noexcept;
+
+        // Blok [first, last) aralığıyla kesişiyor mu (yalnızca başlık okunur)
+        [[nodiscard]] bool overlaps(std::size_t index, SerialDate first, SerialDate last) const noexcept;
+
+        // Bloğu out'a çözer; yazılan satır sayısını döndürür.
+        std::size_t decode_block(std::size_t index, SerialDate* out) const noexcept;
+
+        // Tüm sütunu satır sırasıyla out'a çözer (out en az rows() eleman).
+        // Bloklar çekirdeklere bölünür (threads = 0: donanım iş parçacığı sayısı).
+        void read_all(SerialDate* out, unsigned threads = 0) const;
+
+        // [first, last) aralığındaki değerleri satır sırasıyla out'a yazar;
+        // aralık dışı bloklar çözülmez. out en az rows() eleman olmalıdır.
+        std::size_t select(SerialDate first, SerialDate last, SerialDate* out) const;
+
+    private:
+        MappedFile m_file;
+        std::uint64_t m_rows = 0;
+        std::vector<column::BlockHeader> m_directory;
+        std::vector<std::uint64_t> m_first_rows;
+    };
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef DATE_EXCEPTION_H
+#define DATE_EXCEPTION_H
+
+#include <stdexcept>
+#include <string>
+
+// Date kütüphanesinin istisnaları. Hepsi DateException'dan türer; what()
+// hatalı değeri de içeren kullanıcıya gösterilebilir bir metin döndürür.
+
+namespace project {
+    class DateException : public std::runtime_error {
+    public:
+        explicit DateException(const std::string& message) : std::runtime_error(message) {}
+    };
+
+    class InvalidYearException : public DateException {
+    public:
+        // min_year en küçük geçerli yıldır; year bundan küçük değilse üst
+        // sınır (ör. DateTime aralığı) aşılmıştır
+        InvalidYearException(int year, int min_year)
+            : DateException("Gecersiz yil: " + std::to_string(year) +
+                            (year < min_year ? " (en az " + std::to_string(min_year) + " olmali)"
+                                             : std::string(" (desteklenen aralik disinda)"))),
+              m_year(year) {}
+
+        [[nodiscard]] int year() const noexcept { return m_year; }
+
+    private:
+        int m_year;
+    };
+
+    class InvalidMonthException : public DateException {
+    public:
+        explicit InvalidMonthException(int month)
+            : DateException("Gecersiz ay: " + std::to_string(month) + " (1-12 arasi olmali)"), m_month(month) {}
+
+        [[nodiscard]] int month() const noexcept { return m_month; }
+
+    private:
+        int m_month;
+    };
+
+    class InvalidDayException : public DateException {
+    public:
+        InvalidDayException(int day, int month, int year)
+            : DateException("Gecersiz gun: " + std::to_string(day) + " (" + std::to_string(month) + "/" +
+                            std::to_string(year) + " ayinda boyle bir gun yok)"),
+              m_day(day) {}
+
+        [[nodiscard]] int day() const noexcept { return m_day; }
+
+    private:
+        int m_day;
+    };
+
+    class InvalidDateFormatException : public DateException {
+    public:
+        explicit InvalidDateFormatException(const std::string& input)
+            : DateException("Gecersiz tarih formati: " + input) {}
+    };
+}
+
+#endif
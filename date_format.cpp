@@ -0,0 +1,176 @@
+#include "date_format.h"
+#include <cstring>
+
+namespace project {
+
+    // Lookup tables
+    namespace {
+        struct Name {
+            const char* text;
+            std::size_t size;
+        };
+
+        template<std::size_t N>
+        constexpr Name name(const char (&text)[N]) {
+            return { text, N - 1 };
+        }
+
+        constexpr Name month_names[] = {
+            name("Ocak"), name("Subat"), name("Mart"), name("Nisan"), name("Mayis"), name("Haziran"),
+            name("Temmuz"), name("Agustos"), name("Eylul"), name("Ekim"), name("Kasim"), name("Aralik")
+        };
+
+        constexpr Name day_names[] = {
+            name("Pazar"), name("Pazartesi"), name("Sali"), name("Carsamba"),
+            name("Persembe"), name("Cuma"), name("Cumartesi")
+        };
+
+        constexpr char digit_pairs[] =
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+
+        inline char* write_2digits(char* p, int value) noexcept {
+            std::memcpy(p, digit_pairs + 2 * value, 2);
+            return p + 2;
+        }
+
+        inline char* write_name(char* p, const Name& n) noexcept {
+            std::memcpy(p, n.text, n.size);
+            return p + n.size;
+        }
+
+        // Yıl en az 4 hane olarak yazılır; 0-9999 dışı yıllar std::to_chars'a kalır.
+        inline char* write_year(char* p, int year) noexcept {
+            if (year >= 0 && year <= 9999) {
+                p = write_2digits(p, year / 100);
+                return write_2digits(p, year % 100);
+            }
+            return std::to_chars(p, p + 12, year).ptr;
+        }
+
+        inline char* write_day(char* p, int day) noexcept {
+            if (day >= 10) {
+                return write_2digits(p, day);
+            }
+            *p = static_cast<char>('0' + day);
+            return p + 1;
+        }
+
+        // p'nin en az max_date_chars karakterlik yeri olmalıdır.
+        char* format_unchecked(char* p, int day, int month, int year, int serial, DateFormat fmt) noexcept {
+            switch (fmt) {
+                case DateFormat::iso:
+                    p = write_year(p, year);
+                    *p++ = '-';
+                    p = write_2digits(p, month);
+                    *p++ = '-';
+                    return write_2digits(p, day);
+                case DateFormat::dmy:
+                    p = write_2digits(p, day);
+                    *p++ = '/';
+                    p = write_2digits(p, month);
+                    *p++ = '/';
+                    return write_year(p, year);
+                case DateFormat::turkish_long:
+                default:
+                    p = write_day(p, day);
+                    *p++ = ' ';
+                    p = write_name(p, month_names[month - 1]);
+                    *p++ = ' ';
+                    p = write_year(p, year);
+                    *p++ = ' ';
+                    return write_name(p, day_names[(serial % 7 + 7) % 7]);
+            }
+        }
+
+        std::to_chars_result format_checked(char* first, char* last, int day, int month, int year,
+                                            int serial, DateFormat fmt) noexcept {
+            if (last - first >= static_cast<std::ptrdiff_t>(max_date_chars)) {
+                return { format_unchecked(first, day, month, year, serial, fmt), std::errc{} };
+            }
+            char buf[max_date_chars];
+            const char* const end = format_unchecked(buf, day, month, year, serial, fmt);
+            const std::ptrdiff_t size = end - buf;
+            if (size > last - first) {
+                return { last, std::errc::value_too_large };
+            }
+            std::memcpy(first, buf, static_cast<std::size_t>(size));
+            return { first + size, std::errc{} };
+        }
+
+        struct Fields {
+            int day;
+            int month;
+            int year;
+            int serial;
+        };
+
+        template<typename Get>
+        FormatDatesResult format_range(char* first, char* last, std::size_t count,
+                                       DateFormat fmt, char separator, Get get) noexcept {
+            char* p = first;
+            for (std::size_t i = 0; i < count; ++i) {
+                const Fields f = get(i);
+                if (last - p > static_cast<std::ptrdiff_t>(max_date_chars)) {
+                    p = format_unchecked(p, f.day, f.month, f.year, f.serial, fmt);
+                    *p++ = separator;
+                    continue;
+                }
+                const std::to_chars_result r = format_checked(p, last, f.day, f.month, f.year, f.serial, fmt);
+                if (r.ec != std::errc{} || r.ptr == last) {
+                    return { p, i, std::errc::value_too_large };
+                }
+                p = r.ptr;
+                *p++ = separator;
+            }
+            return { p, count, std::errc{} };
+        }
+    }
+
+    std::string_view weekday_name(Date::Weekday day) noexcept {
+        const Name& n = day_names[static_cast<int>(day)];
+        return { n.text, n.size };
+    }
+
+    std::to_chars_result to_chars(char* first, char* last, const Date& date, DateFormat fmt) noexcept {
+        PROJECT_DATE_METRIC_TIME(format);
+        PROJECT_DATE_METRIC_COUNT(format);
+        return format_checked(first, last, date.get_month_day(), date.get_month(), date.get_year(),
+                              date.get_day_serial(), fmt);
+    }
+
+    std::to_chars_result to_chars(char* first, char* last, SerialDate date, DateFormat fmt) noexcept {
+        PROJECT_DATE_METRIC_TIME(format);
+        PROJECT_DATE_METRIC_COUNT(format);
+        const civil::CivilDate c = civil::civil_from_days(date.serial());
+        return format_checked(first, last, c.day, c.month, c.year, date.serial(), fmt);
+    }
+
+    FormatDatesResult format_dates(char* first, char* last, const Date* dates, std::size_t count,
+                                   DateFormat fmt, char separator) noexcept {
+        PROJECT_DATE_METRIC_TIME(format);
+        PROJECT_DATE_METRIC_ADD(format, count);
+        return format_range(first, last, count, fmt, separator, [dates](std::size_t i) {
+            const Date& d = dates[i];
+            return Fields{ d.get_month_day(), d.get_month(), d.get_year(), d.get_day_serial() };
+        });
+    }
+
+    FormatDatesResult format_dates(char* first, char* last, const SerialDate* dates, std::size_t count,
+                                   DateFormat fmt, char separator) noexcept {
+        PROJECT_DATE_METRIC_TIME(format);
+        PROJECT_DATE_METRIC_ADD(format, count);
+        return format_range(first, last, count, fmt, separator, [dates](std::size_t i) {
+            const civil::CivilDate c = civil::civil_from_days(dates[i].serial());
+            return Fields{ c.day, c.month, c.year, dates[i].serial() };
+        });
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef DATE_FORMAT_H
+#define DATE_FORMAT_H
+
+#include <charconv>
+#include <cstddef>
+#include <string_view>
+#include <system_error>
+#include "date.h"
+#include "serial_date.h"
+
+namespace project {
+    enum class DateFormat {
+        turkish_long,   // "15 Subat 1998 Pazar" (operator<< çıktısı)
+        iso,            // "1998-02-15"
+        dmy             // "15/02/1998"
+    };
+
+    // Tek bir tarihin her biçimde yazılabileceği en fazla karakter sayısı.
+    inline constexpr std::size_t max_date_chars = 40;
+
+    // std::to_chars gibi çalışır: bellek ayırmaz, istisna fırlatmaz. Tampon
+    // yetmezse { last, std::errc::value_too_large } döner.
+    std::to_chars_result to_chars(char* first, char* last, const Date& date,
+                                  DateFormat fmt = DateFormat::turkish_long) noexcept;
+    std::to_chars_result to_chars(char* first, char* last, SerialDate date,
+                                  DateFormat fmt = DateFormat::turkish_long) noexcept;
+
+    // "Pazar", "Pazartesi", ...
+    [[nodiscard]] std::string_view weekday_name(Date::Weekday day) noexcept;
+
+    struct FormatDatesResult {
+        char* ptr;          // son tam yazılan kaydın (ve ayracının) sonu
+        std::size_t count;  // tam yazılan kayıt sayısı
+        std::errc ec;
+    };
+
+    // Tarih dizisini tek bir bitişik tampona, her kaydın ardına separator
+    // koyarak yazar. Tampon dolarsa yazılabilen kayıtlarla durur; kalan
+    // kayıtlar dates + count'tan itibaren yeni bir tamponla devam ettirilebilir.
+    FormatDatesResult format_dates(char* first, char* last, const Date* dates, std::size_t count,
+                                   DateFormat fmt = DateFormat::turkish_long, char separator = '\n') noexcept;
+    FormatDatesResult format_dates(char* first, char* last, const SerialDate* dates, std::size_t count,
+                                   DateFormat fmt = DateFormat::turkish_long, char separator = '\n') noexcept;
+}
+
+#endif
@@ -0,0 +1,201 @@
+#include "date_histogram.h"
+#include "date_parallel.h"
+#include <algorithm>
+
+namespace project {
+
+    // Helper functions
+    namespace {
+        constexpr std::size_t block_rows = 2048;
+        // Bu sayıdan küçük işler bölünmez
+        constexpr std::size_t min_task_rows = std::size_t{ 1 } << 16;
+        // Ardışık satırlar ayrı sayaçlara yazılır; az bucket'lı sayımlarda
+        // (haftanın günü) aynı sayaca art arda yazmanın bağımlılığı kırılır.
+        constexpr std::size_t lanes = 4;
+
+        // Sabit aralıklı bucket'lar; yıl için false
+        bool fixed_range(DateBucket bucket, int& first, int& last) noexcept {
+            switch (bucket) {
+                case DateBucket::weekday:  first = 0; last = 6; return true;
+                case DateBucket::month:    first = 1; last = 12; return true;
+                case DateBucket::quarter:  first = 1; last = 4; return true;
+                case DateBucket::iso_week: first = 1; last = 53; return true;
+                case DateBucket::year_day: first = 1; last = 366; return true;
+                default:                   return false;
+            }
+        }
+
+        // Bir görevin kısmi histogramı: bucket başına lanes sayaç
+        struct Partial {
+            int first = 0;
+            int last = -1;
+            std::vector<std::uint64_t> counts;
+            std::vector<double> sums;
+
+            // [lo, hi] aralığını kapsayacak şekilde genişletir
+            void cover(int lo, int hi, bool with_sums) {
+                if (last >= first && lo >= first && hi <= last) {
+                    return;
+                }
+                const int new_first = last >= first ? std::min(lo, first) : lo;
+                const int new_last = last >= first ? std::max(hi, last) : hi;
+                const std::size_t size = static_cast<std::size_t>(new_last - new_first + 1) * lanes;
+                std::vector<std::uint64_t> c(size, 0);
+                std::vector<double> s(with_sums ? size : 0, 0.0);
+                if (last >= first) {
+                    const std::size_t shift = static_cast<std::size_t>(first - new_first) * lanes;
+                    std::copy(counts.begin(), counts.end(), c.begin() + shift);
+                    if (with_sums) {
+                        std::copy(sums.begin(), sums.end(), s.begin() + shift);
+                    }
+                }
+                counts = std::move(c);
+                sums = std::move(s);
+                first = new_first;
+                last = new_last;
+            }
+        };
+
+        // ids[k], partial aralığındaki bucket değeridir
+        template <typename Id>
+        void count_block(Partial& partial, const Id* ids, const double* values, std::size_t n) noexcept {
+            const int first = partial.first;
+            std::uint64_t* counts = partial.counts.data();
+            std::size_t k = 0;
+            if (values) {
+                double* sums = partial.sums.data();
+                for (; k < n; ++k) {
+                    const std::size_t slot = static_cast<std::size_t>(ids[k] - first) * lanes + (k & (lanes - 1));
+                    ++counts[slot];
+                    sums[slot] += values[k];
+                }
+            } else {
+                for (; k + lanes <= n; k += lanes) {
+                    ++counts[static_cast<std::size_t>(ids[k] - first) * lanes];
+                    ++counts[static_cast<std::size_t>(ids[k + 1] - first) * lanes + 1];
+                    ++counts[static_cast<std::size_t>(ids[k + 2] - first) * lanes + 2];
+                    ++counts[static_cast<std::size_t>(ids[k + 3] - first) * lanes + 3];
+                }
+                for (; k < n; ++k) {
+                    ++counts[static_cast<std::size_t>(ids[k] - first) * lanes + (k & (lanes - 1))];
+                }
+            }
+        }
+
+        // load(i, n, buffer): [i, i + n) satırlarının seri numaraları
+        template <typename Load>
+        void accumulate(Partial& partial, Load load, const double* values, std::size_t begin, std::size_t end,
+                        DateBucket bucket) {
+            std::int32_t buffer[block_rows];
+            std::uint16_t ids[block_rows];
+            // Yıl bucket'ı 16 bite sığmaz; yıllar from_serials ile tam alınır
+            std::int32_t days[block_rows];
+            std::int32_t months[block_rows];
+            std::int32_t years[block_rows];
+            for (std::size_t i = begin; i < end; i += block_rows) {
+                const std::size_t n = std::min(block_rows, end - i);
+                const std::int32_t* serials = load(i, n, buffer);
+                const double* block_values = values ? values + i : nullptr;
+                if (bucket == DateBucket::year) {
+                    batch::from_serials(serials, days, months, years, n);
+                    const auto range = std::minmax_element(years, years + n);
+                    partial.cover(*range.first, *range.second, values != nullptr);
+                    count_block(partial, years, block_values, n);
+                } else {
+                    batch::bucket_ids(serials, ids, n, bucket);
+                    count_block(partial, ids, block_values, n);
+                }
+            }
+        }
+
+        template <typename Load>
+        DateGroups aggregate(Load load, const double* values, std::size_t count, DateBucket bucket, unsigned threads) {
+            const std::size_t tasks = std::max<std::size_t>(
+                1, std::min<std::size_t>(parallel::thread_count(threads), count / min_task_rows));
+            std::vector<Partial> partials(tasks);
+            int first = 0;
+            int last = 0;
+            if (fixed_range(bucket, first, last)) {
+                for (Partial& partial : partials) {
+                    partial.cover(first, last, values != nullptr);
+                }
+            }
+            parallel::for_each_task(tasks, static_cast<unsigned>(tasks), [&](std::size_t t) {
+                accumulate(partials[t], load, values, count * t / tasks, count * (t + 1) / tasks, bucket);
+            });
+
+            // Birleştirme: tüm görevlerin aralıklarının birleşimi
+            DateGroups result;
+            result.bucket = bucket;
+            int lo = 0;
+            int hi = -1;
+            for (const Partial& partial : partials) {
+                if (partial.last < partial.first) {
+                    continue;
+                }
+                lo = hi < lo ? partial.first : std::min(lo, partial.first);
+                hi = std::max(hi, partial.last);
+            }
+            if (hi < lo) {
+                return result;
+            }
+            result.first = lo;
+            result.counts.assign(static_cast<std::size_t>(hi - lo + 1), 0);
+            if (values) {
+                result.sums.assign(result.counts.size(), 0.0);
+            }
+            for (const Partial& partial : partials) {
+                for (int b = partial.first; b <= partial.last; ++b) {
+                    const std::size_t from = static_cast<std::size_t>(b - partial.first) * lanes;
+                    const std::size_t to = static_cast<std::size_t>(b - lo);
+                    for (std::size_t l = 0; l < lanes; ++l) {
+                        result.counts[to] += partial.counts[from + l];
+                        if (values) {
+                            result.sums[to] += partial.sums[from + l];
+                        }
+                    }
+                }
+            }
+            return result;
+        }
+
+        auto load_serials(const std::int32_t* serials) noexcept {
+            return [serials](std::size_t i, std::size_t, std::int32_t*) { return serials + i; };
+        }
+
+        auto load_dates(const SerialDate* dates) noexcept {
+            return [dates](std::size_t i, std::size_t n, std::int32_t* buffer) {
+                for (std::size_t k = 0; k < n; ++k) {
+                    buffer[k] = dates[i + k].serial();
+                }
+                return static_cast<const std::int32_t*>(buffer);
+            };
+        }
+    }
+
+    std::uint64_t DateHistogram::total() const noexcept {
+        std::uint64_t sum = 0;
+        for (const std::uint64_t n : counts) {
+            sum += n;
+        }
+        return sum;
+    }
+
+    DateHistogram histogram(const std::int32_t* serials, std::size_t count, DateBucket bucket, unsigned threads) {
+        return aggregate(load_serials(serials), nullptr, count, bucket, threads);
+    }
+
+    DateHistogram histogram(const SerialDate* dates, std::size_t count, DateBucket bucket, unsigned threads) {
+        return aggregate(load_dates(dates), nullptr, count, bucket, threads);
+    }
+
+    DateGroups group_by(const std::int32_t* serials, const double* values, std::size_t count,
+                        DateBucket bucket, unsigned threads) {
+        return aggregate(load_serials(serials), values, count, bucket, threads);
+    }
+
+    DateGroups group_by(const SerialDate* dates, const double* values, std::size_t count,
+                        DateBucket bucket, unsigned threads) {
+        return aggregate(load_dates(dates), values, count, bucket, threads);
+    }
+}
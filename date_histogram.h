@@ -0,0 +1,60 @@
+#ifndef DATE_HISTOGRAM_H
+#define DATE_HISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "date_batch.h"
+#include "serial_date.h"
+
+// Tarih sütunlarını haftanın günü, ay, çeyrek, ISO hafta, yılın günü ya da
+// yıl bucket'larına göre sayar. Bucket değerleri batch::bucket_ids ile
+// vektörel hesaplanır; her iş parçacığı kendi kısmi histogramını tutar ve
+// sonuçlar en sonda birleştirilir (threads = 0: donanım iş parçacığı sayısı).
+
+namespace project {
+    using DateBucket = batch::Bucket;
+
+    // counts[i], first + i bucket değerindeki satır sayısıdır. Sabit aralıklı
+    // bucket'larda tüm aralık bulunur (ör. ay: 1-12); yıl için aralık
+    // verideki en küçük ve en büyük yıldır ve her yıl ayrı sayılır
+    // (batch::bucket_ids'teki 16 bitlik doyurma burada yoktur).
+    struct DateHistogram {
+        DateBucket bucket = DateBucket::weekday;
+        int first = 0;
+        std::vector<std::uint64_t> counts;
+
+        [[nodiscard]] std::uint64_t count(int value) const noexcept {
+            const long long i = static_cast<long long>(value) - first;
+            return i >= 0 && i < static_cast<long long>(counts.size()) ? counts[static_cast<std::size_t>(i)] : 0;
+        }
+        [[nodiscard]] std::uint64_t total() const noexcept;
+    };
+
+    // Group-by: her bucket için satır sayısı ve values toplamı
+    struct DateGroups : DateHistogram {
+        std::vector<double> sums;
+
+        [[nodiscard]] double sum(int value) const noexcept {
+            const long long i = static_cast<long long>(value) - first;
+            return i >= 0 && i < static_cast<long long>(sums.size()) ? sums[static_cast<std::size_t>(i)] : 0.0;
+        }
+        // Boş bucket için 0
+        [[nodiscard]] double mean(int value) const noexcept {
+            const std::uint64_t n = count(value);
+            return n != 0 ? sum(value) / static_cast<double>(n) : 0.0;
+        }
+    };
+
+    [[nodiscard]] DateHistogram histogram(const std::int32_t* serials, std::size_t count, DateBucket bucket,
+                                          unsigned threads = 0);
+    [[nodiscard]] DateHistogram histogram(const SerialDate* dates, std::size_t count, DateBucket bucket,
+                                          unsigned threads = 0);
+
+    [[nodiscard]] DateGroups group_by(const std::int32_t* serials, const double* values, std::size_t count,
+                                      DateBucket bucket, unsigned threads = 0);
+    [[nodiscard]] DateGroups group_by(const SerialDate* dates, const double* values, std::size_t count,
+                                      DateBucket bucket, unsigned threads = 0);
+}
+
+#endif
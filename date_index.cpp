@@ -0,0 +1,175 @@
+#include "date_index.h"
+#include "date_bits.h"
+#include <stdexcept>
+
+namespace project {
+
+    namespace {
+        // x - min, x >= min iken; fark int32'ye sığmayabileceğinden 64 bitte
+        std::uint32_t offset_from(SerialDate::rep x, SerialDate::rep min) noexcept {
+            return static_cast<std::uint32_t>(static_cast<std::int64_t>(x) - min);
+        }
+    }
+
+    // Constructors
+    DateIndex::DateIndex(const SerialDate* keys, std::size_t count) {
+        build(keys, count);
+    }
+
+    DateIndex::DateIndex(const Date* keys, std::size_t count) {
+        std::vector<SerialDate> serials(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            serials[i] = SerialDate{ keys[i] };
+        }
+        build(serials.data(), count);
+    }
+
+    // Queries
+    std::size_t DateIndex::lower_bound(SerialDate date) const noexcept {
+        const SerialDate::rep x = date.serial();
+        if (!m_directory.empty()) {
+            if (x <= m_min) {
+                return 0;
+            }
+            const std::uint32_t offset = offset_from(x, m_min);
+            return offset < m_directory.size() ? m_directory[offset] : m_keys.size();
+        }
+        if (m_tree.size() <= 1) {
+            return 0;
+        }
+        const std::size_t blocks = m_tree.size() - 1;
+
+        // Dalsız iniş; dört seviye sonrası önceden getirilir
+        std::size_t node = 1;
+        while (node <= blocks) {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(m_tree.data() + (node * block_size < m_tree.size() ? node * block_size : 0));
+#endif
+            node = 2 * node + (m_tree[node] < x);
+        }
+        // Son sola dönüşe geri çık: en büyük anahtarı >= x olan ilk blok
+        node >>= bits::countr_zero(~static_cast<std::uint64_t>(node)) + 1;
+        if (node == 0) {
+            return m_keys.size();
+        }
+
+        const std::size_t first = static_cast<std::size_t>(m_tree_block[node]) * block_size;
+        const std::size_t last = first + block_size < m_keys.size() ? first + block_size : m_keys.size();
+        std::size_t pos = first;
+        for (std::size_t i = first; i < last; ++i) {
+            pos += m_keys[i].serial() < x;
+        }
+        return pos;
+    }
+
+    DateIndexSpan DateIndex::range(SerialDate first, SerialDate last) const noexcept {
+        const std::size_t lo = lower_bound(first);
+        const std::size_t hi = last < first ? lo : lower_bound(last);
+        return { m_keys.data() + lo, m_rows.data() + lo, hi - lo };
+    }
+
+    // Helper functions
+    void DateIndex::build(const SerialDate* keys, std::size_t count) {
+        if (count > UINT32_MAX) {
+            throw std::length_error("DateIndex en fazla 2^32 satir tutabilir");
+        }
+        m_keys.resize(count);
+        m_rows.resize(count);
+        m_tree.assign(1, 0);
+        m_tree_block.assign(1, 0);
+        m_directory.clear();
+        if (count == 0) {
+            return;
+        }
+
+        SerialDate::rep min = keys[0].serial();
+        SerialDate::rep max = min;
+        for (std::size_t i = 1; i < count; ++i) {
+            const SerialDate::rep s = keys[i].serial();
+            min = s < min ? s : min;
+            max = s > max ? s : max;
+        }
+        m_min = min;
+
+        const std::uint32_t span = offset_from(max, min);
+        if (span / 2 <= count) {
+            build_directory(keys, count, span);
+        } else {
+            build_sorted(keys, count, span);
+        }
+    }
+
+    // Gün başına sayma: dizin, sıralamanın ön ek toplamının kendisidir.
+    void DateIndex::build_directory(const SerialDate* keys, std::size_t count, std::uint32_t span) {
+        m_directory.assign(static_cast<std::size_t>(span) + 1, 0);
+        for (std::size_t i = 0; i < count; ++i) {
+            ++m_directory[offset_from(keys[i].serial(), m_min)];
+        }
+        std::uint32_t sum = 0;
+        for (std::uint32_t& offset : m_directory) {
+            const std::uint32_t n = offset;
+            offset = sum;
+            sum += n;
+        }
+
+        std::vector<std::uint32_t> next(m_directory);
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::uint32_t pos = next[offset_from(keys[i].serial(), m_min)]++;
+            m_keys[pos] = keys[i];
+            m_rows[pos] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    void DateIndex::build_sorted(const SerialDate* keys, std::size_t count, std::uint32_t span) {
+        const SerialDate::rep min = m_min;
+
+        // Üst 32 bit: min'e göre göreli anahtar, alt 32 bit: satır. LSD radix
+        // sıralama kararlıdır; eşit anahtarlar satır sırasında kalır.
+        std::vector<std::uint64_t> items(count);
+        std::vector<std::uint64_t> scratch(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            items[i] = (static_cast<std::uint64_t>(offset_from(keys[i].serial(), min)) << 32) | i;
+        }
+
+        constexpr int radix_bits = 11;
+        constexpr std::size_t buckets = std::size_t{ 1 } << radix_bits;
+        for (int shift = 0; shift < 32 && (span >> shift) != 0; shift += radix_bits) {
+            std::size_t offsets[buckets] = {};
+            for (std::size_t i = 0; i < count; ++i) {
+                ++offsets[(items[i] >> (32 + shift)) & (buckets - 1)];
+            }
+            std::size_t sum = 0;
+            for (std::size_t& offset : offsets) {
+                const std::size_t n = offset;
+                offset = sum;
+                sum += n;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                scratch[offsets[(items[i] >> (32 + shift)) & (buckets - 1)]++] = items[i];
+            }
+            items.swap(scratch);
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            m_keys[i] = SerialDate::from_serial(static_cast<SerialDate::rep>(min + static_cast<std::int64_t>(items[i] >> 32)));
+            m_rows[i] = static_cast<std::uint32_t>(items[i]);
+        }
+
+        const std::size_t blocks = (count + block_size - 1) / block_size;
+        m_tree.resize(blocks + 1);
+        m_tree_block.resize(blocks + 1);
+        build_tree(0, 1);
+    }
+
+    // Bloklar sıra ile (in-order) ağaca yerleştirilir.
+    std::size_t DateIndex::build_tree(std::size_t block, std::size_t node) noexcept {
+        if (node < m_tree.size()) {
+            block = build_tree(block, 2 * node);
+            const std::size_t last = (block + 1) * block_size - 1;
+            m_tree[node] = m_keys[last < m_keys.size() ? last : m_keys.size() - 1].serial();
+            m_tree_block[node] = static_cast<std::uint32_t>(block);
+            block = build_tree(block + 1, 2 * node + 1);
+        }
+        return block;
+    }
+}
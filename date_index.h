@@ -0,0 +1,91 @@
+#ifndef DATE_INDEX_H
+#define DATE_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "date.h"
+#include "serial_date.h"
+
+namespace project {
+    // Bir sorgunun sonucu: sıralı dizide ardışık bir dilim. keys[i], satır
+    // rows[i]'nin tarihidir; eşit tarihler satır numarası sırasındadır.
+    struct DateIndexSpan {
+        const SerialDate* keys;
+        const std::uint32_t* rows;
+        std::size_t count;
+
+        [[nodiscard]] const std::uint32_t* begin() const noexcept { return rows; }
+        [[nodiscard]] const std::uint32_t* end() const noexcept { return rows + count; }
+        [[nodiscard]] std::size_t size() const noexcept { return count; }
+        [[nodiscard]] bool empty() const noexcept { return count == 0; }
+    };
+
+    // Tarih anahtarlı satırlar için salt okunur sıralı indeks. Anahtarlar gün
+    // seri numarasına göre LSD radix sort ile sıralanır. Arama, 16 anahtarlık
+    // (bir önbellek satırı) blokların en büyük anahtarları üzerinde Eytzinger
+    // düzeninde ağaç inişi ve ardından tek blok taramasıdır. Gün aralığı satır
+    // sayısına göre dar ise (span <= 2 * count) bunun yerine sayma sıralaması
+    // ve gün başına bir ofset tutan dizin kullanılır; arama tek okumadır.
+    // Satır numarası olarak girdideki sıra (0 tabanlı) kullanılır.
+    class DateIndex {
+    public:
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+        static constexpr std::size_t block_size = 16;
+
+        // Constructors
+        DateIndex() = default;
+        DateIndex(const SerialDate* keys, std::size_t count);
+        DateIndex(const Date* keys, std::size_t count);
+
+        [[nodiscard]] std::size_t size() const noexcept { return m_keys.size(); }
+        [[nodiscard]] bool empty() const noexcept { return m_keys.empty(); }
+        [[nodiscard]] SerialDate key(std::size_t pos) const noexcept { return m_keys[pos]; }
+        [[nodiscard]] std::uint32_t row(std::size_t pos) const noexcept { return m_rows[pos]; }
+
+        // Sıralı konum: ilk key >= date / ilk key > date
+        [[nodiscard]] std::size_t lower_bound(SerialDate date) const noexcept;
+        [[nodiscard]] std::size_t upper_bound(SerialDate date) const noexcept {
+            return date.serial() == std::numeric_limits<SerialDate::rep>::max() ? size() : lower_bound(date + 1);
+        }
+
+        // [first, last) aralığındaki satırlar
+        [[nodiscard]] DateIndexSpan range(SerialDate first, SerialDate last) const noexcept;
+        [[nodiscard]] DateIndexSpan range(const Date& first, const Date& last) const noexcept {
+            return range(SerialDate{ first }, SerialDate{ last });
+        }
+        [[nodiscard]] DateIndexSpan equal_range(SerialDate date) const noexcept {
+            const std::size_t lo = lower_bound(date);
+            return { m_keys.data() + lo, m_rows.data() + lo, upper_bound(date) - lo };
+        }
+
+        // date'ten kesin olarak önceki en yakın anahtarın konumu (yoksa npos).
+        // Aynı tarihte birden çok satır varsa sonuncusu döner.
+        [[nodiscard]] std::size_t predecessor(SerialDate date) const noexcept {
+            const std::size_t pos = lower_bound(date);
+            return pos == 0 ? npos : pos - 1;
+        }
+        [[nodiscard]] std::size_t predecessor(const Date& date) const noexcept {
+            return predecessor(SerialDate{ date });
+        }
+
+    private:
+        void build(const SerialDate* keys, std::size_t count);
+        void build_directory(const SerialDate* keys, std::size_t count, std::uint32_t span);
+        void build_sorted(const SerialDate* keys, std::size_t count, std::uint32_t span);
+        std::size_t build_tree(std::size_t block, std::size_t node) noexcept;
+
+        std::vector<SerialDate> m_keys;
+        std::vector<std::uint32_t> m_rows;
+        // 1 tabanlı Eytzinger dizisi: düğümdeki bloğun en büyük anahtarı ve
+        // o bloğun sıra numarası
+        std::vector<SerialDate::rep> m_tree;
+        std::vector<std::uint32_t> m_tree_block;
+        // Yoğun dizin: m_directory[s - m_min], ilk key >= s konumu
+        std::vector<std::uint32_t> m_directory;
+        SerialDate::rep m_min = 0;
+    };
+}
+
+#endif
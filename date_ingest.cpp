@@ -0,0 +1,152 @@
+#include "date_ingest.h"
+#include "date_mmap.h"
+#include "date_parallel.h"
+#include "date_parse.h"
+#include <chrono>
+#include <cstring>
+
+namespace project {
+
+    // Helper functions
+    namespace {
+        struct Chunk {
+            const char* first;
+            const char* last;
+            std::uint64_t first_row = 0;
+            std::vector<IngestError> errors;
+        };
+
+        const char* line_end(const char* p, const char* last) noexcept {
+            const void* nl = std::memchr(p, '\n', static_cast<std::size_t>(last - p));
+            return nl ? static_cast<const char*>(nl) : last;
+        }
+
+        bool blank(const char* first, const char* last) noexcept {
+            return first == last || (last - first == 1 && *first == '\r');
+        }
+
+        std::uint64_t count_rows(const char* p, const char* last) noexcept {
+            std::uint64_t rows = 0;
+            while (p < last) {
+                const char* end = line_end(p, last);
+                rows += !blank(p, end);
+                p = end + 1;
+            }
+            return rows;
+        }
+
+        DateErrc parse_field(const char* p, const char* end, const IngestOptions& options,
+                             SerialDate& out) noexcept {
+            for (std::size_t c = 0; c < options.column; ++c) {
+                const void* d = std::memchr(p, options.delimiter, static_cast<std::size_t>(end - p));
+                if (!d) {
+                    return DateErrc::invalid_format;
+                }
+                p = static_cast<const char*>(d) + 1;
+            }
+            const void* d = std::memchr(p, options.delimiter, static_cast<std::size_t>(end - p));
+            const char* field_end = d ? static_cast<const char*>(d) : end;
+
+            while (p < field_end && (*p == ' ' || *p == '\t' || *p == '"')) {
+                ++p;
+            }
+            while (field_end > p && (field_end[-1] == ' ' || field_end[-1] == '\t' ||
+                                     field_end[-1] == '\r' || field_end[-1] == '"')) {
+                --field_end;
+            }
+
+            int day, month, year;
+            const DateParseResult r = scan_date({ p, static_cast<std::size_t>(field_end - p) }, day, month, year);
+            if (r.ec != DateErrc::ok) {
+                return r.ec;
+            }
+            if (r.ptr != field_end) {
+                return DateErrc::invalid_format;
+            }
+            const DateErrc ec = Date::check_date(day, month, year);
+            if (ec == DateErrc::ok) {
+                out = SerialDate::from_serial(civil::days_from_civil(day, month, year));
+            }
+            return ec;
+        }
+
+        void parse_chunk(Chunk& chunk, const char* base, const IngestOptions& options,
+                         SerialDate* out) {
+            std::uint64_t row = chunk.first_row;
+            const char* p = chunk.first;
+            while (p < chunk.last) {
+                const char* end = line_end(p, chunk.last);
+                if (!blank(p, end)) {
+                    SerialDate date;
+                    const DateErrc ec = parse_field(p, end, options, date);
+                    if (ec != DateErrc::ok) {
+                        chunk.errors.push_back({ row, static_cast<std::uint64_t>(p - base), ec });
+                    }
+                    out[row++] = date;
+                }
+                p = end + 1;
+            }
+        }
+    }
+
+    IngestResult ingest_date_column(const char* data, std::size_t size, const IngestOptions& options) {
+        const auto start = std::chrono::steady_clock::now();
+        IngestResult result;
+        const char* first = data;
+        const char* last = data + size;
+        if (options.header && first < last) {
+            first = line_end(first, last) + 1;
+            first = first < last ? first : last;
+        }
+
+        // Parça sınırları bir sonraki satır başına kaydırılır
+        std::vector<Chunk> chunks;
+        const std::size_t chunk_bytes = options.chunk_bytes != 0 ? options.chunk_bytes : 1;
+        for (const char* p = first; p < last;) {
+            const char* end = static_cast<std::size_t>(last - p) > chunk_bytes ? p + chunk_bytes : last;
+            if (end < last && end[-1] != '\n') {
+                end = line_end(end, last);
+                end = end < last ? end + 1 : last;
+            }
+            chunks.push_back({ p, end, 0, {} });
+            p = end;
+        }
+
+        std::vector<std::uint64_t> rows(chunks.size());
+        parallel::for_each_task(chunks.size(), options.threads, [&](std::size_t i) {
+            rows[i] = count_rows(chunks[i].first, chunks[i].last);
+        });
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < chunks.size(); ++i) {
+            chunks[i].first_row = total;
+            total += rows[i];
+        }
+
+        result.dates.resize(static_cast<std::size_t>(total));
+        SerialDate* out = result.dates.data();
+        parallel::for_each_task(chunks.size(), options.threads, [&](std::size_t i) {
+            parse_chunk(chunks[i], data, options, out);
+        });
+
+        for (Chunk& chunk : chunks) {
+            result.errors.insert(result.errors.end(), chunk.errors.begin(), chunk.errors.end());
+        }
+
+        PROJECT_DATE_METRIC_ADD(parse, total);
+        PROJECT_DATE_METRIC_ADD(parse_failed, result.errors.size());
+        result.stats.rows = total;
+        result.stats.bytes = size;
+        result.stats.errors = result.errors.size();
+        result.stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return result;
+    }
+
+    IngestResult ingest_date_column(const std::string& path, const IngestOptions& options) {
+        const auto start = std::chrono::steady_clock::now();
+        const MappedFile file(path);
+        file.advise_sequential();
+        IngestResult result = ingest_date_column(file.data(), file.size(), options);
+        result.stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return result;
+    }
+}
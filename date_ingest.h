@@ -0,0 +1,59 @@
+#ifndef DATE_INGEST_H
+#define DATE_INGEST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "date.h"
+#include "serial_date.h"
+
+namespace project {
+    struct IngestOptions {
+        std::size_t column = 0;              // 0 tabanlı sütun
+        char delimiter = ',';
+        bool header = false;                 // ilk satırı atla
+        unsigned threads = 0;                // 0: donanım iş parçacığı sayısı
+        std::size_t chunk_bytes = 1 << 20;   // satır sonuna hizalanan parça boyu
+    };
+
+    // Hatalı satır: veri satırı sırası (başlık ve boş satırlar sayılmaz),
+    // satırın dosyadaki bayt ofseti ve hata kodu.
+    struct IngestError {
+        std::uint64_t row;
+        std::uint64_t offset;
+        DateErrc ec;
+    };
+
+    struct IngestStats {
+        std::uint64_t rows = 0;
+        std::uint64_t bytes = 0;
+        std::uint64_t errors = 0;
+        double seconds = 0;
+
+        [[nodiscard]] double rows_per_second() const noexcept { return seconds > 0 ? rows / seconds : 0; }
+        [[nodiscard]] double bytes_per_second() const noexcept { return seconds > 0 ? bytes / seconds : 0; }
+    };
+
+    // dates[i], i. veri satırının tarihidir; hatalı satırlar için varsayılan
+    // SerialDate yazılır ve satır errors'a eklenir (satır sırasıyla).
+    struct IngestResult {
+        std::vector<SerialDate> dates;
+        std::vector<IngestError> errors;
+        IngestStats stats;
+    };
+
+    // Ayraçlı metinden (CSV, log) bir tarih sütununu okur. Girdi satır sonuna
+    // hizalı parçalara bölünür; parçalar önce satır sayımı, sonra doğrudan
+    // çıktı dizisine ayrıştırma için iş çalan havuzda işlenir. Alan çevresindeki
+    // boşluk, '\r' ve çift tırnaklar atlanır. Boş satırlar yok sayılır.
+    // Satır hataları istisna fırlatmaz.
+    [[nodiscard]] IngestResult ingest_date_column(const char* data, std::size_t size,
+                                                  const IngestOptions& options = {});
+
+    // Dosyayı eşler ve yukarıdaki gibi okur; açma hataları std::runtime_error.
+    [[nodiscard]] IngestResult ingest_date_column(const std::string& path,
+                                                  const IngestOptions& options = {});
+}
+
+#endif
@@ -0,0 +1,167 @@
+#include "date_metrics.h"
+#include <cstdio>
+
+#if PROJECT_DATE_METRICS
+#include <algorithm>
+#include <mutex>
+#include <vector>
+#endif
+
+namespace project::metrics {
+
+    const char* name(Counter c) noexcept {
+        switch (c) {
+            case Counter::construct:         return "construct";
+            case Counter::validation_failed: return "validation_failed";
+            case Counter::parse:             return "parse";
+            case Counter::parse_failed:      return "parse_failed";
+            case Counter::format_exception:  return "format_exception";
+            case Counter::format:            return "format";
+            case Counter::arithmetic:        return "arithmetic";
+            default:                         return "unknown";
+        }
+    }
+
+    const char* name(Timer t) noexcept {
+        switch (t) {
+            case Timer::parse:      return "parse";
+            case Timer::format:     return "format";
+            case Timer::stream_out: return "stream_out";
+            default:                return "unknown";
+        }
+    }
+
+#if PROJECT_DATE_METRICS
+    namespace {
+        // Canlı iş parçacıklarının yuvaları, sonlanmış olanların toplamı ve
+        // son reset() anındaki toplam. Yuvalara yalnızca sahipleri yazar;
+        // reset() onları sıfırlamak yerine tabanı kaydeder, snapshot() da
+        // farkı döndürür. Böylece sıfırlama ile eşzamanlı artışlar kaybolmaz.
+        struct Registry {
+            std::mutex mutex;
+            std::vector<detail::ThreadSlot*> live;
+            Snapshot retired{};
+            Snapshot baseline{};
+        };
+
+        Registry& registry() {
+            static Registry* r = new Registry;   // iş parçacıkları kapanırken de erişilebilir kalır
+            return *r;
+        }
+
+        void accumulate(Snapshot& s, const detail::ThreadSlot& slot) noexcept {
+            for (int c = 0; c < counter_count; ++c) {
+                s.counters[c] += slot.counters[c].load(std::memory_order_relaxed);
+            }
+            for (int t = 0; t < timer_count; ++t) {
+                Histogram& h = s.timers[t];
+                for (int b = 0; b < histogram_buckets; ++b) {
+                    const std::uint64_t n = slot.buckets[t][b].load(std::memory_order_relaxed);
+                    h.buckets[b] += n;
+                    h.count += n;
+                }
+                h.sum_ns += slot.sum_ns[t].load(std::memory_order_relaxed);
+            }
+        }
+
+        // r.mutex tutulurken çağrılır
+        Snapshot total(const Registry& r) noexcept {
+            Snapshot s = r.retired;
+            for (const detail::ThreadSlot* slot : r.live) {
+                accumulate(s, *slot);
+            }
+            return s;
+        }
+
+        // Toplamlar tekdüze arttığından fark hiçbir zaman eksiye düşmez.
+        void subtract(Snapshot& s, const Snapshot& base) noexcept {
+            for (int c = 0; c < counter_count; ++c) {
+                s.counters[c] -= base.counters[c];
+            }
+            for (int t = 0; t < timer_count; ++t) {
+                for (int b = 0; b < histogram_buckets; ++b) {
+                    s.timers[t].buckets[b] -= base.timers[t].buckets[b];
+                }
+                s.timers[t].count -= base.timers[t].count;
+                s.timers[t].sum_ns -= base.timers[t].sum_ns;
+            }
+        }
+
+        struct SlotHandle {
+            detail::ThreadSlot slot{};
+
+            SlotHandle() {
+                Registry& r = registry();
+                std::lock_guard<std::mutex> lock{ r.mutex };
+                r.live.push_back(&slot);
+            }
+
+            ~SlotHandle() {
+                Registry& r = registry();
+                std::lock_guard<std::mutex> lock{ r.mutex };
+                accumulate(r.retired, slot);
+                r.live.erase(std::remove(r.live.begin(), r.live.end(), &slot), r.live.end());
+            }
+        };
+    }
+
+    detail::ThreadSlot& detail::local_slot() noexcept {
+        thread_local SlotHandle handle;
+        return handle.slot;
+    }
+
+    Snapshot snapshot() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock{ r.mutex };
+        Snapshot s = total(r);
+        subtract(s, r.baseline);
+        return s;
+    }
+
+    void reset() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock{ r.mutex };
+        r.baseline = total(r);
+    }
+#else
+    Snapshot snapshot() {
+        return Snapshot{};
+    }
+
+    void reset() {}
+#endif
+
+    std::string export_text(const Snapshot& s) {
+        std::string out;
+        char line[160];
+
+        out += "# TYPE project_date_ops_total counter\n";
+        for (int c = 0; c < counter_count; ++c) {
+            std::snprintf(line, sizeof(line), "project_date_ops_total{op=\"%s\"} %llu\n",
+                          name(static_cast<Counter>(c)), static_cast<unsigned long long>(s.counters[c]));
+            out += line;
+        }
+
+        out += "# TYPE project_date_latency_ns histogram\n";
+        for (int t = 0; t < timer_count; ++t) {
+            const Histogram& h = s.timers[t];
+            const char* op = name(static_cast<Timer>(t));
+            std::uint64_t cumulative = 0;
+            for (int b = 0; b < histogram_buckets - 1; ++b) {
+                cumulative += h.buckets[b];
+                std::snprintf(line, sizeof(line), "project_date_latency_ns_bucket{op=\"%s\",le=\"%llu\"} %llu\n",
+                              op, (1ULL << b) - 1, static_cast<unsigned long long>(cumulative));
+                out += line;
+            }
+            std::snprintf(line, sizeof(line),
+                          "project_date_latency_ns_bucket{op=\"%s\",le=\"+Inf\"} %llu\n"
+                          "project_date_latency_ns_sum{op=\"%s\"} %llu\n"
+                          "project_date_latency_ns_count{op=\"%s\"} %llu\n",
+                          op, static_cast<unsigned long long>(h.count),
+                          op, static_cast<unsigned long long>(h.sum_ns),
+                          op, static_cast<unsigned long long>(h.count));
+            out += line;
+        }
+        return out;
+    }
+}
@@ -0,0 +1,151 @@
+#ifndef DATE_METRICS_H
+#define DATE_METRICS_H
+
+// Date işlemleri için isteğe bağlı, iş parçacığı başına sayaç ve gecikme
+// histogramları. PROJECT_DATE_METRICS=1 ile (tüm çeviri birimlerinde aynı
+// değerle) derlenmediğinde ölçüm makroları boş açılır ve hiçbir maliyeti
+// yoktur; snapshot() bu durumda sıfırlar döndürür.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifndef PROJECT_DATE_METRICS
+#define PROJECT_DATE_METRICS 0
+#endif
+
+#if PROJECT_DATE_METRICS
+#include <atomic>
+#include <chrono>
+#endif
+
+namespace project::metrics {
+
+    enum class Counter {
+        construct,           // Date(d, m, y)
+        validation_failed,   // Date(d, m, y), setter ve try_make'te geçersiz gün/ay/yıl
+        parse,               // Date(const char*), parse_date ve parse_dates_fixed girişleri
+        parse_failed,        // bu girişlerden okunamayan ya da geçersiz olanlar
+        format_exception,    // Date(const char*) içinden fırlatılan InvalidDateFormatException
+        format,              // metne yazılan tarih
+        arithmetic,          // +=, -=, ++, --, operator+, operator-(int)
+        count_
+    };
+
+    // Süre yalnızca saat okumasından (~20 ns) belirgin uzun süren işlemler
+    // için ölçülür. Kurma, gün aritmetiği ve doğrulama constexpr ve ~1 ns
+    // sürer; onlarda ölçülen, işlemin değil saatin maliyeti olurdu (örneklense
+    // de). Bu yüzden bu işlemler yalnızca sayılır.
+    enum class Timer {
+        parse,        // Date(const char*)
+        format,       // to_chars / format_dates (çağrı başına)
+        stream_out,   // operator<<
+        count_
+    };
+
+    inline constexpr int counter_count = static_cast<int>(Counter::count_);
+    inline constexpr int timer_count = static_cast<int>(Timer::count_);
+    // i. kova [2^(i-1), 2^i) ns aralığındaki süreleri sayar; son kova taşmaları da içerir.
+    inline constexpr int histogram_buckets = 32;
+
+    struct Histogram {
+        std::uint64_t buckets[histogram_buckets];
+        std::uint64_t count;
+        std::uint64_t sum_ns;
+    };
+
+    struct Snapshot {
+        std::uint64_t counters[counter_count];
+        Histogram timers[timer_count];
+    };
+
+    [[nodiscard]] constexpr bool enabled() noexcept { return PROJECT_DATE_METRICS != 0; }
+    [[nodiscard]] const char* name(Counter c) noexcept;
+    [[nodiscard]] const char* name(Timer t) noexcept;
+
+    // Canlı ve sonlanmış tüm iş parçacıklarının toplamı.
+    [[nodiscard]] Snapshot snapshot();
+    // Sonraki snapshot()'lar bu andan sonraki işlemleri sayar; yuvalara
+    // dokunmadığından diğer iş parçacıklarının artışlarıyla yarışmaz.
+    void reset();
+    // Prometheus metin biçimi (metrik ajanının kazıması için).
+    [[nodiscard]] std::string export_text(const Snapshot& s);
+
+#if PROJECT_DATE_METRICS
+    namespace detail {
+        struct ThreadSlot {
+            std::atomic<std::uint64_t> counters[counter_count];
+            std::atomic<std::uint64_t> buckets[timer_count][histogram_buckets];
+            std::atomic<std::uint64_t> sum_ns[timer_count];
+        };
+
+        ThreadSlot& local_slot() noexcept;
+
+        // Sahibi tek yazar olduğundan kilitli RMW yerine load+store yeterlidir.
+        inline void bump(std::atomic<std::uint64_t>& a, std::uint64_t n) noexcept {
+            a.store(a.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        }
+
+        inline int bucket_of(std::uint64_t ns) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            const int b = ns ? 64 - __builtin_clzll(ns) : 0;
+#else
+            int b = 0;
+            for (std::uint64_t v = ns; v != 0; v >>= 1) {
+                ++b;
+            }
+#endif
+            return b < histogram_buckets - 1 ? b : histogram_buckets - 1;
+        }
+    }
+
+    inline void add(Counter c, std::uint64_t n = 1) noexcept {
+        detail::bump(detail::local_slot().counters[static_cast<int>(c)], n);
+    }
+
+    inline void record(Timer t, std::uint64_t ns) noexcept {
+        detail::ThreadSlot& slot = detail::local_slot();
+        detail::bump(slot.buckets[static_cast<int>(t)][detail::bucket_of(ns)], 1);
+        detail::bump(slot.sum_ns[static_cast<int>(t)], ns);
+    }
+
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(Timer t) noexcept : m_timer(t), m_start(std::chrono::steady_clock::now()) {}
+        ~ScopedTimer() {
+            const auto elapsed = std::chrono::steady_clock::now() - m_start;
+            record(m_timer, static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        Timer m_timer;
+        std::chrono::steady_clock::time_point m_start;
+    };
+#endif
+}
+
+// Hook macros
+// constexpr fonksiyonlarda da kullanılabilir: sabit ifade değerlendirmesi
+// sırasında sayılmaz.
+#if PROJECT_DATE_METRICS
+#define PROJECT_DATE_METRIC_ADD(counter, n)                                          \
+    do {                                                                             \
+        if (!__builtin_is_constant_evaluated())                                      \
+            ::project::metrics::add(::project::metrics::Counter::counter, (n));      \
+    } while (false)
+#define PROJECT_DATE_METRIC_CONCAT_(a, b) a##b
+#define PROJECT_DATE_METRIC_CONCAT(a, b) PROJECT_DATE_METRIC_CONCAT_(a, b)
+#define PROJECT_DATE_METRIC_TIME(timer)                                              \
+    ::project::metrics::ScopedTimer PROJECT_DATE_METRIC_CONCAT(date_metric_timer_, __LINE__) { \
+        ::project::metrics::Timer::timer }
+#else
+#define PROJECT_DATE_METRIC_ADD(counter, n) ((void)0)
+#define PROJECT_DATE_METRIC_TIME(timer) ((void)0)
+#endif
+
+#define PROJECT_DATE_METRIC_COUNT(counter) PROJECT_DATE_METRIC_ADD(counter, 1)
+
+#endif
@@ -0,0 +1,98 @@
+#include "date_mmap.h"
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define PROJECT_DATE_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define PROJECT_DATE_HAS_MMAP 0
+#endif
+
+namespace project {
+
+    // Constructors
+    MappedFile::MappedFile(const std::string& path) {
+#if PROJECT_DATE_HAS_MMAP
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Dosya acilamadi: " + path);
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Dosya boyutu okunamadi: " + path);
+        }
+        m_size = static_cast<std::size_t>(st.st_size);
+        if (m_size != 0) {
+            void* p = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Dosya eslenemedi: " + path);
+            }
+            m_data = static_cast<const char*>(p);
+            m_mapped = true;
+        }
+        ::close(fd);   // eşleme dosya tanıtıcısından bağımsızdır
+#else
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) {
+            throw std::runtime_error("Dosya acilamadi: " + path);
+        }
+        m_buffer.resize(static_cast<std::size_t>(in.tellg()));
+        in.seekg(0);
+        if (!in.read(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()))) {
+            throw std::runtime_error("Dosya okunamadi: " + path);
+        }
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+#endif
+    }
+
+    MappedFile::~MappedFile() {
+        release();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            release();
+            m_buffer = std::move(other.m_buffer);
+            m_data = other.m_mapped ? other.m_data : m_buffer.data();
+            m_size = other.m_size;
+            m_mapped = other.m_mapped;
+            other.m_data = nullptr;
+            other.m_size = 0;
+            other.m_mapped = false;
+        }
+        return *this;
+    }
+
+    void MappedFile::advise_sequential() const noexcept {
+#if PROJECT_DATE_HAS_MMAP
+        if (m_mapped) {
+            ::madvise(const_cast<char*>(m_data), m_size, MADV_SEQUENTIAL);
+        }
+#endif
+    }
+
+    // Helper functions
+    void MappedFile::release() noexcept {
+#if PROJECT_DATE_HAS_MMAP
+        if (m_mapped) {
+            ::munmap(const_cast<char*>(m_data), m_size);
+        }
+#endif
+        m_buffer.clear();
+        m_data = nullptr;
+        m_size = 0;
+        m_mapped = false;
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef DATE_MMAP_H
+#define DATE_MMAP_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace project {
+    // Salt okunur dosya eşlemesi. POSIX sistemlerde mmap kullanılır; diğer
+    // ortamlarda dosya belleğe okunur (aynı arayüz, kopyalı).
+    class MappedFile {
+    public:
+        MappedFile() noexcept = default;
+        explicit MappedFile(const std::string& path);
+        ~MappedFile();
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        [[nodiscard]] const char* data() const noexcept { return m_data; }
+        [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+        [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+        // Baştan sona okunacağını çekirdeğe bildirir (destekleniyorsa).
+        void advise_sequential() const noexcept;
+
+    private:
+        void release() noexcept;
+
+        const char* m_data = nullptr;
+        std::size_t m_size = 0;
+        bool m_mapped = false;
+        std::vector<char> m_buffer;   // mmap olmayan ortamlar
+    };
+}
+
+#endif
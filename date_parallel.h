@@ -0,0 +1,107 @@
+#ifndef DATE_PARALLEL_H
+#define DATE_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Toplu işlemlerin çekirdeklere bölünmesi için küçük yardımcılar.
+
+namespace project::parallel {
+
+    // 0: donanımın desteklediği iş parçacığı sayısı
+    inline unsigned thread_count(unsigned requested = 0) noexcept {
+        if (requested != 0) {
+            return requested;
+        }
+        const unsigned hw = std::thread::hardware_concurrency();
+        return hw != 0 ? hw : 1;
+    }
+
+    // [0, count) aralığını en fazla threads parçaya böler ve f(begin, end)'i
+    // her parça için ayrı bir iş parçacığında çağırır; son parça çağıran
+    // iş parçacığında çalışır. min_chunk'tan küçük işler bölünmez.
+    // f istisna fırlatmamalıdır.
+    template<typename F>
+    void for_each_chunk(std::size_t count, unsigned threads, F f, std::size_t min_chunk = 1 << 14) {
+        if (count == 0) {
+            return;
+        }
+        const std::size_t max_parts = (count + min_chunk - 1) / min_chunk;
+        const std::size_t parts = std::min<std::size_t>(thread_count(threads), max_parts);
+        if (parts <= 1) {
+            f(std::size_t{ 0 }, count);
+            return;
+        }
+
+        std::vector<std::thread> workers;
+        workers.reserve(parts - 1);
+        const std::size_t chunk = (count + parts - 1) / parts;
+        for (std::size_t p = 0; p + 1 < parts; ++p) {
+            const std::size_t begin = p * chunk;
+            workers.emplace_back([&f, begin, end = std::min(begin + chunk, count)] { f(begin, end); });
+        }
+        f((parts - 1) * chunk, count);
+        for (std::thread& t : workers) {
+            t.join();
+        }
+    }
+
+    // [0, count) görevlerini iş çalan bir havuzda çalıştırır: her iş
+    // parçacığı kendi bitişik görev aralığının başından alır, bitince diğer
+    // iş parçacıklarının kalan görevlerini çalar. Görev süreleri eşit
+    // değilse (ör. farklı yoğunlukta dosya parçaları) for_each_chunk'tan
+    // daha dengelidir. f(index) istisna fırlatmamalıdır.
+    template<typename F>
+    void for_each_task(std::size_t count, unsigned threads, F f) {
+        if (count == 0) {
+            return;
+        }
+        const std::size_t parts = std::min<std::size_t>(thread_count(threads), count);
+        if (parts <= 1) {
+            for (std::size_t i = 0; i < count; ++i) {
+                f(i);
+            }
+            return;
+        }
+
+        // Her kuyruk ayrı önbellek satırında
+        struct alignas(64) Queue {
+            std::atomic<std::size_t> next;
+            std::size_t end;
+        };
+        const std::unique_ptr<Queue[]> queues(new Queue[parts]);
+        for (std::size_t p = 0; p < parts; ++p) {
+            queues[p].next.store(count * p / parts, std::memory_order_relaxed);
+            queues[p].end = count * (p + 1) / parts;
+        }
+
+        const auto work = [&](std::size_t self) {
+            for (std::size_t k = 0; k < parts; ++k) {
+                Queue& q = queues[(self + k) % parts];
+                for (;;) {
+                    const std::size_t i = q.next.fetch_add(1, std::memory_order_relaxed);
+                    if (i >= q.end) {
+                        break;
+                    }
+                    f(i);
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(parts - 1);
+        for (std::size_t p = 1; p < parts; ++p) {
+            workers.emplace_back(work, p);
+        }
+        work(0);
+        for (std::thread& t : workers) {
+            t.join();
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,221 @@
+#include "date_parse.h"
+#include "date_simd.h"
+
+namespace project {
+
+    // Helper functions
+    namespace {
+        constexpr int max_field_digits = 9;   // int taşmasını önler
+
+        constexpr bool is_digit(char c) noexcept {
+            return static_cast<unsigned>(c - '0') <= 9;
+        }
+
+        constexpr bool is_delimiter(char c) noexcept {
+            return c == '/' || c == '-' || c == '.';
+        }
+
+        const char* read_number(const char* p, const char* last, int& value) noexcept {
+            const char* const first = p;
+            int v = 0;
+            while (p != last && is_digit(*p)) {
+                if (p - first == max_field_digits) {
+                    return nullptr;
+                }
+                v = v * 10 + (*p - '0');
+                ++p;
+            }
+            if (p == first) {
+                return nullptr;
+            }
+            value = v;
+            return p;
+        }
+
+        constexpr int digit(const char* p, int i) noexcept {
+            return p[i] - '0';
+        }
+
+        // Sabit genişlikli kayıt: "gg/aa/yyyy"
+        bool decode_fixed_scalar(const char* p, int& day, int& month, int& year) noexcept {
+            constexpr int digit_positions[] = { 0, 1, 3, 4, 6, 7, 8, 9 };
+            for (int i : digit_positions) {
+                if (!is_digit(p[i])) {
+                    return false;
+                }
+            }
+            if (!is_delimiter(p[2]) || !is_delimiter(p[5])) {
+                return false;
+            }
+            day = digit(p, 0) * 10 + digit(p, 1);
+            month = digit(p, 3) * 10 + digit(p, 4);
+            year = digit(p, 6) * 1000 + digit(p, 7) * 100 + digit(p, 8) * 10 + digit(p, 9);
+            return true;
+        }
+
+        inline bool store_fixed(int day, int month, int year, std::size_t i,
+                                SerialDate* out, DateErrc* errors) noexcept {
+            const DateErrc ec = Date::check_date(day, month, year);
+            if (errors) {
+                errors[i] = ec;
+            }
+            if (ec != DateErrc::ok) {
+                return false;
+            }
+            out[i] = SerialDate::from_serial(civil::days_from_civil(day, month, year));
+            return true;
+        }
+
+        std::size_t parse_fixed_scalar(const char* buf, std::size_t first, std::size_t count,
+                                       std::size_t stride, SerialDate* out, DateErrc* errors) noexcept {
+            std::size_t parsed = 0;
+            for (std::size_t i = first; i < count; ++i) {
+                int day, month, year;
+                if (!decode_fixed_scalar(buf + i * stride, day, month, year)) {
+                    if (errors) {
+                        errors[i] = DateErrc::invalid_format;
+                    }
+                    continue;
+                }
+                parsed += store_fixed(day, month, year, i, out, errors);
+            }
+            return parsed;
+        }
+
+#if PROJECT_DATE_X86_DISPATCH
+        // 16 baytlık tek yükleme ile 8 rakam ve 2 ayraç birlikte doğrulanır;
+        // rakam çiftleri pmaddubsw ile tek adımda sayıya çevrilir.
+        PROJECT_DATE_TARGET("sse4.1")
+        inline bool decode_fixed_sse41(const char* p, int& day, int& month, int& year) noexcept {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            const __m128i digits = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+            const __m128i digit_lanes = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+            const __m128i delim_lanes = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('/')), _mm_cmpeq_epi8(v, _mm_set1_epi8('-'))),
+                _mm_cmpeq_epi8(v, _mm_set1_epi8('.')));
+
+            constexpr int digit_mask = 0x3DB;   // 0,1,3,4,6,7,8,9
+            constexpr int delim_mask = 0x024;   // 2,5
+            if ((_mm_movemask_epi8(digit_lanes) & 0x3FF) != digit_mask ||
+                (_mm_movemask_epi8(delim_lanes) & delim_mask) != delim_mask) {
+                return false;
+            }
+
+            const __m128i packed = _mm_shuffle_epi8(digits,
+                _mm_setr_epi8(0, 1, 3, 4, 6, 7, 8, 9, -1, -1, -1, -1, -1, -1, -1, -1));
+            const __m128i pairs = _mm_maddubs_epi16(packed,
+                _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 0, 0, 0, 0, 0, 0, 0, 0));
+            day = _mm_extract_epi16(pairs, 0);
+            month = _mm_extract_epi16(pairs, 1);
+            year = _mm_extract_epi16(pairs, 2) * 100 + _mm_extract_epi16(pairs, 3);
+            return true;
+        }
+
+        PROJECT_DATE_TARGET("sse4.1")
+        std::size_t parse_fixed_sse41(const char* buf, std::size_t count, std::size_t stride,
+                                      SerialDate* out, DateErrc* errors) noexcept {
+            // Son kayıtlarda 16 baytlık yükleme tamponun dışına taşabilir;
+            // onlar skaler yola bırakılır.
+            const char* const last = buf + (count - 1) * stride + 10;
+            std::size_t parsed = 0;
+            std::size_t i = 0;
+            for (; i < count && buf + i * stride + 16 <= last; ++i) {
+                int day, month, year;
+                if (!decode_fixed_sse41(buf + i * stride, day, month, year)) {
+                    if (errors) {
+                        errors[i] = DateErrc::invalid_format;
+                    }
+                    continue;
+                }
+                parsed += store_fixed(day, month, year, i, out, errors);
+            }
+            return parsed + parse_fixed_scalar(buf, i, count, stride, out, errors);
+        }
+#endif
+    }
+
+    DateParseResult scan_date(std::string_view text, int& day, int& month, int& year) noexcept {
+        const char* p = text.data();
+        const char* const last = p + text.size();
+        int d, m, y;
+
+        if (!(p = read_number(p, last, d)) || p == last || !is_delimiter(*p)) {
+            return { text.data(), DateErrc::invalid_format };
+        }
+        if (!(p = read_number(p + 1, last, m)) || p == last || !is_delimiter(*p)) {
+            return { text.data(), DateErrc::invalid_format };
+        }
+        if (!(p = read_number(p + 1, last, y))) {
+            return { text.data(), DateErrc::invalid_format };
+        }
+
+        day = d;
+        month = m;
+        year = y;
+        return { p, DateErrc::ok };
+    }
+
+    DateParseResult parse_date(std::string_view text, Date& date) noexcept {
+        PROJECT_DATE_METRIC_COUNT(parse);
+        int d, m, y;
+        DateParseResult result = scan_date(text, d, m, y);
+        if (result.ec != DateErrc::ok) {
+            PROJECT_DATE_METRIC_COUNT(parse_failed);
+            return result;
+        }
+        const DateResult made = Date::try_make(d, m, y);
+        if (!made) {
+            PROJECT_DATE_METRIC_COUNT(parse_failed);
+            return { text.data(), made.error() };
+        }
+        date = *made;
+        return result;
+    }
+
+    DateParseResult parse_date(std::string_view text, SerialDate& date) noexcept {
+        PROJECT_DATE_METRIC_COUNT(parse);
+        int d, m, y;
+        DateParseResult result = scan_date(text, d, m, y);
+        if (result.ec == DateErrc::ok) {
+            result.ec = Date::check_date(d, m, y);
+        }
+        if (result.ec != DateErrc::ok) {
+            PROJECT_DATE_METRIC_COUNT(parse_failed);
+            result.ptr = text.data();
+            return result;
+        }
+        date = SerialDate::from_serial(civil::days_from_civil(d, m, y));
+        return result;
+    }
+
+    DateResult try_parse_date(std::string_view text) noexcept {
+        Date date;
+        const DateParseResult result = parse_date(text, date);
+        if (result.ec != DateErrc::ok) {
+            return result.ec;
+        }
+        if (result.ptr != text.data() + text.size()) {
+            return DateErrc::invalid_format;
+        }
+        return date;
+    }
+
+    std::size_t parse_dates_fixed(const char* buf, std::size_t count, std::size_t stride,
+                                  SerialDate* out, DateErrc* errors) noexcept {
+        if (count == 0) {
+            return 0;
+        }
+        std::size_t parsed;
+#if PROJECT_DATE_X86_DISPATCH
+        if (simd::active_level() != simd::Level::scalar) {
+            parsed = parse_fixed_sse41(buf, count, stride, out, errors);
+        } else
+#endif
+        {
+            parsed = parse_fixed_scalar(buf, 0, count, stride, out, errors);
+        }
+        PROJECT_DATE_METRIC_ADD(parse, count);
+        PROJECT_DATE_METRIC_ADD(parse_failed, count - parsed);
+        return parsed;
+    }
+}
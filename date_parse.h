@@ -0,0 +1,35 @@
+#ifndef DATE_PARSE_H
+#define DATE_PARSE_H
+
+#include <cstddef>
+#include <string_view>
+#include "date.h"
+#include "serial_date.h"
+
+namespace project {
+    // ptr, okunan son karakterin bir sonrasını gösterir (std::from_chars gibi).
+    struct DateParseResult {
+        const char* ptr;
+        DateErrc ec;
+    };
+
+    // "gg/aa/yyyy" biçimini okur; ayraç olarak '/', '-' ve '.' kabul edilir.
+    // Alanların takvim geçerliliği denetlenmez. Bellek ayırmaz, istisna fırlatmaz.
+    [[nodiscard]] DateParseResult scan_date(std::string_view text, int& day, int& month, int& year) noexcept;
+
+    // scan_date + Date::check_date. Hata durumunda date değiştirilmez.
+    [[nodiscard]] DateParseResult parse_date(std::string_view text, Date& date) noexcept;
+    [[nodiscard]] DateParseResult parse_date(std::string_view text, SerialDate& date) noexcept;
+
+    // Tüm metnin tek bir tarih olmasını bekler; artık karakter varsa invalid_format.
+    [[nodiscard]] DateResult try_parse_date(std::string_view text) noexcept;
+
+    // Sabit genişlikli "gg/aa/yyyy" kayıtlarından oluşan bitişik tamponu okur.
+    // i. kayıt buf + i * stride adresinde başlar (stride >= 10). Hatalı kayıtlar
+    // için out değiştirilmez, errors verilmişse hata kodu yazılır.
+    // Başarıyla okunan kayıt sayısını döndürür.
+    std::size_t parse_dates_fixed(const char* buf, std::size_t count, std::size_t stride,
+                                  SerialDate* out, DateErrc* errors = nullptr) noexcept;
+}
+
+#endif
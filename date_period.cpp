@@ -0,0 +1,14 @@
+#include "date_period.h"
+#include "date_parallel.h"
+
+namespace project {
+
+    void period_between(const SerialDate* from, const SerialDate* to, Period* out,
+                        std::size_t count, unsigned threads) {
+        parallel::for_each_chunk(count, threads, [=](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                out[i] = period_between(from[i], to[i]);
+            }
+        });
+    }
+}
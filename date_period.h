@@ -0,0 +1,65 @@
+#ifndef DATE_PERIOD_H
+#define DATE_PERIOD_H
+
+#include <cstddef>
+#include "date.h"
+#include "serial_date.h"
+
+namespace project {
+    struct Period {
+        int years;
+        int months;
+        int days;
+    };
+
+    [[nodiscard]] constexpr bool operator==(const Period& p1, const Period& p2) noexcept {
+        return p1.years == p2.years && p1.months == p2.months && p1.days == p2.days;
+    }
+
+    [[nodiscard]] constexpr bool operator!=(const Period& p1, const Period& p2) noexcept {
+        return !(p1 == p2);
+    }
+
+    // Ay/yıl ekleme; gün hedef ayın uzunluğuna kırpılır.
+    [[nodiscard]] constexpr Date add_months(const Date& date, int months) noexcept {
+        const civil::CivilDate c = civil::add_months({ date.get_month_day(), date.get_month(), date.get_year() }, months);
+        return Date::from_day_serial(civil::days_from_civil(c.day, c.month, c.year));
+    }
+
+    [[nodiscard]] constexpr Date add_years(const Date& date, int years) noexcept {
+        return add_months(date, years * 12);
+    }
+
+    // from'dan to'ya kadar geçen tam yıl, ay ve kalan gün sayısı (sabit zaman).
+    // Ay eklemede gün ay sonuna kırpılır: 31/01'den 28/02'ye 1 ay, 29/02
+    // doğumlular artık olmayan yıllarda yaşlarını 28/02'de doldurur.
+    // to < from ise tüm alanlar negatif olarak döner.
+    [[nodiscard]] constexpr Period period_between(SerialDate from, SerialDate to) noexcept {
+        if (to < from) {
+            const Period p = period_between(to, from);
+            return { -p.years, -p.months, -p.days };
+        }
+        const civil::CivilDate f = civil::civil_from_days(from.serial());
+        const civil::CivilDate t = civil::civil_from_days(to.serial());
+
+        int months = (t.year - f.year) * 12 + (t.month - f.month);
+        civil::CivilDate anchor = civil::add_months(f, months);
+        if (civil::days_from_civil(anchor.day, anchor.month, anchor.year) > to.serial()) {
+            --months;
+            anchor = civil::add_months(f, months);
+        }
+        const int days = to.serial() - civil::days_from_civil(anchor.day, anchor.month, anchor.year);
+        return { months / 12, months % 12, days };
+    }
+
+    [[nodiscard]] constexpr Period period_between(const Date& from, const Date& to) noexcept {
+        return period_between(SerialDate{ from }, SerialDate{ to });
+    }
+
+    // out[i] = period_between(from[i], to[i]); iş tüm çekirdeklere bölünür
+    // (threads = 0: donanım iş parçacığı sayısı).
+    void period_between(const SerialDate* from, const SerialDate* to, Period* out,
+                        std::size_t count, unsigned threads = 0);
+}
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef DATE_PROTOCOL_H
+#define DATE_PROTOCOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include "date.h"
+
+// Tarih servisinin ikili protokolü. Bağlantı üzerinden sabit boyutlu
+// kayıtlar art arda gönderilir; çerçeve başlığı yoktur. Tüm alanlar little
+// endian'dır. Tarihler yyyymmdd tamsayısıdır (15/02/1998 -> 19980215);
+// istemcinin kütüphaneye ihtiyacı olmaz.
+//
+//   İstek (16 bayt)  : id u32 | op u8 | 3 bayt boş | a i32 | b i32
+//   Yanıt (20 bayt)  : id u32 | op u8 | status u8 | 2 bayt boş | v0 v1 v2 i32
+//
+//   op           a            b                    yanıt
+//   age          doğum        referans (0: bugün)  yıl, ay, gün
+//   diff         tarih1       tarih2               tarih2 - tarih1
+//   add_days     tarih        gün                  yyyymmdd
+//   weekday      tarih        -                    0-6 (0 = Pazar)
+//   leap_check   yıl          -                    1 / 0
+//
+// Yanıtlar her bağlantıda isteklerle aynı sırada döner; id istemcinindir.
+
+namespace project::service {
+    enum class Op : std::uint8_t {
+        age = 1,
+        diff = 2,
+        add_days = 3,
+        weekday = 4,
+        leap_check = 5
+    };
+
+    enum class Status : std::uint8_t {
+        ok = 0,
+        invalid_year = 1,
+        invalid_month = 2,
+        invalid_day = 3,
+        invalid_op = 4,
+        birth_in_future = 5
+    };
+
+    struct Request {
+        std::uint32_t id = 0;
+        Op op = Op::age;
+        std::int32_t a = 0;
+        std::int32_t b = 0;
+    };
+
+    struct Response {
+        std::uint32_t id = 0;
+        Op op = Op::age;
+        Status status = Status::ok;
+        std::int32_t value[3] = {};
+    };
+
+    inline constexpr std::size_t request_bytes = 16;
+    inline constexpr std::size_t response_bytes = 20;
+
+    [[nodiscard]] constexpr std::int32_t pack_date(const Date& date) noexcept {
+        return date.get_year() * 10000 + date.get_month() * 100 + date.get_month_day();
+    }
+
+    // Helper functions
+    inline void put_u32(unsigned char* p, std::uint32_t v) noexcept {
+        p[0] = static_cast<unsigned char>(v);
+        p[1] = static_cast<unsigned char>(v >> 8);
+        p[2] = static_cast<unsigned char>(v >> 16);
+        p[3] = static_cast<unsigned char>(v >> 24);
+    }
+
+    [[nodiscard]] inline std::uint32_t get_u32(const unsigned char* p) noexcept {
+        return static_cast<std::uint32_t>(p[0]) | static_cast<std::uint32_t>(p[1]) << 8 |
+               static_cast<std::uint32_t>(p[2]) << 16 | static_cast<std::uint32_t>(p[3]) << 24;
+    }
+
+    // Encoding
+    inline void encode(const Request& r, unsigned char* p) noexcept {
+        put_u32(p, r.id);
+        put_u32(p + 4, static_cast<std::uint8_t>(r.op));
+        put_u32(p + 8, static_cast<std::uint32_t>(r.a));
+        put_u32(p + 12, static_cast<std::uint32_t>(r.b));
+    }
+
+    inline void decode(const unsigned char* p, Request& r) noexcept {
+        r.id = get_u32(p);
+        r.op = static_cast<Op>(p[4]);
+        r.a = static_cast<std::int32_t>(get_u32(p + 8));
+        r.b = static_cast<std::int32_t>(get_u32(p + 12));
+    }
+
+    inline void encode(const Response& r, unsigned char* p) noexcept {
+        put_u32(p, r.id);
+        put_u32(p + 4, static_cast<std::uint32_t>(static_cast<std::uint8_t>(r.op)) |
+                       static_cast<std::uint32_t>(static_cast<std::uint8_t>(r.status)) << 8);
+        for (int i = 0; i < 3; ++i) {
+            put_u32(p + 8 + i * 4, static_cast<std::uint32_t>(r.value[i]));
+        }
+    }
+
+    inline void decode(const unsigned char* p, Response& r) noexcept {
+        r.id = get_u32(p);
+        r.op = static_cast<Op>(p[4]);
+        r.status = static_cast<Status>(p[5]);
+        for (int i = 0; i < 3; ++i) {
+            r.value[i] = static_cast<std::int32_t>(get_u32(p + 8 + i * 4));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,83 @@
+#include "date_random.h"
+#include "date_parallel.h"
+
+namespace project {
+
+    // Helper functions
+    namespace {
+        constexpr std::size_t parallel_block = 1 << 16;
+
+        std::uint64_t splitmix64(std::uint64_t& x) noexcept {
+            std::uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        std::uint64_t block_seed(std::uint64_t seed, std::size_t block) noexcept {
+            std::uint64_t x = seed ^ (static_cast<std::uint64_t>(block) * 0xD1B54A32D192ED03ULL);
+            return splitmix64(x);
+        }
+
+        template<typename T>
+        void fill_blocks(std::uint64_t seed, int min_year, int max_year, T* out, std::size_t count, unsigned threads) {
+            DateGenerator::check_range(min_year, max_year);   // iş parçacıkları başlamadan
+            const std::size_t blocks = (count + parallel_block - 1) / parallel_block;
+            parallel::for_each_chunk(blocks, threads, [=](std::size_t first, std::size_t last) {
+                for (std::size_t b = first; b < last; ++b) {
+                    const std::size_t begin = b * parallel_block;
+                    const std::size_t size = begin + parallel_block < count ? parallel_block : count - begin;
+                    DateGenerator gen{ block_seed(seed, b), min_year, max_year };
+                    gen.fill(out + begin, size);
+                }
+            }, 1);
+        }
+    }
+
+    Xoshiro256::Xoshiro256(std::uint64_t seed) noexcept {
+        for (std::uint64_t& s : m_state) {
+            s = splitmix64(seed);
+        }
+    }
+
+    DateGenerator::DateGenerator(std::uint64_t seed, int min_year, int max_year)
+        : m_engine(seed) {
+        check_range(min_year, max_year);
+        m_first = civil::days_from_civil(1, 1, min_year);
+        m_range = static_cast<std::uint32_t>(civil::days_from_civil(31, 12, max_year) - m_first + 1);
+    }
+
+    void DateGenerator::check_range(int min_year, int max_year) {
+        if (min_year < Date::year_base) {
+            throw InvalidYearException(min_year, Date::year_base);
+        }
+        if (max_year < min_year) {
+            throw InvalidYearException(max_year, min_year);
+        }
+        if (max_year > Date::max_year) {
+            throw InvalidYearException(max_year, Date::year_base);
+        }
+    }
+
+    void DateGenerator::fill(SerialDate* out, std::size_t count) noexcept {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = next_serial();
+        }
+    }
+
+    void DateGenerator::fill(Date* out, std::size_t count) noexcept {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = next();
+        }
+    }
+
+    void DateGenerator::fill_parallel(std::uint64_t seed, int min_year, int max_year,
+                                      SerialDate* out, std::size_t count, unsigned threads) {
+        fill_blocks(seed, min_year, max_year, out, count, threads);
+    }
+
+    void DateGenerator::fill_parallel(std::uint64_t seed, int min_year, int max_year,
+                                      Date* out, std::size_t count, unsigned threads) {
+        fill_blocks(seed, min_year, max_year, out, count, threads);
+    }
+}
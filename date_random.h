@@ -0,0 +1,95 @@
+#ifndef DATE_RANDOM_H
+#define DATE_RANDOM_H
+
+#include <cstddef>
+#include <cstdint>
+#include "date.h"
+#include "serial_date.h"
+
+namespace project {
+    // xoshiro256** üreteci; UniformRandomBitGenerator gereksinimlerini karşılar.
+    class Xoshiro256 {
+    public:
+        using result_type = std::uint64_t;
+
+        explicit Xoshiro256(std::uint64_t seed) noexcept;
+
+        static constexpr result_type min() noexcept { return 0; }
+        static constexpr result_type max() noexcept { return ~result_type{ 0 }; }
+
+        result_type operator()() noexcept {
+            const std::uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+            const std::uint64_t t = m_state[1] << 17;
+            m_state[2] ^= m_state[0];
+            m_state[3] ^= m_state[1];
+            m_state[1] ^= m_state[2];
+            m_state[0] ^= m_state[3];
+            m_state[2] ^= t;
+            m_state[3] = rotl(m_state[3], 45);
+            return result;
+        }
+
+    private:
+        static constexpr std::uint64_t rotl(std::uint64_t x, int k) noexcept {
+            return (x << k) | (x >> (64 - k));
+        }
+
+        std::uint64_t m_state[4];
+    };
+
+    // [min_year, max_year] aralığındaki günlerden düzgün dağılımlı tarih
+    // üretir: her çekiliş tek bir gün seri numarasıdır. Nesne iş parçacıkları
+    // arasında paylaşılmamalıdır; her iş parçacığı kendi üretecini kullanır.
+    class DateGenerator {
+    public:
+        DateGenerator(std::uint64_t seed, int min_year = Date::random_min_year,
+                      int max_year = Date::random_max_year);
+
+        // year_base <= min_year <= max_year <= Date::max_year değilse
+        // InvalidYearException fırlatır.
+        static void check_range(int min_year, int max_year);
+
+        [[nodiscard]] SerialDate next_serial() noexcept {
+            return SerialDate::from_serial(m_first + static_cast<std::int32_t>(bounded()));
+        }
+
+        [[nodiscard]] Date next() noexcept {
+            return Date::from_day_serial(next_serial().serial());
+        }
+
+        void fill(SerialDate* out, std::size_t count) noexcept;
+        void fill(Date* out, std::size_t count) noexcept;
+
+        [[nodiscard]] SerialDate first() const noexcept { return SerialDate::from_serial(m_first); }
+        [[nodiscard]] SerialDate last() const noexcept {
+            return SerialDate::from_serial(m_first + static_cast<std::int32_t>(m_range - 1));
+        }
+
+        // Çok çekirdekli doldurma. Dizi sabit boyutlu bloklara bölünür ve her
+        // blok seed ile blok numarasından türetilen kendi üretecini kullanır;
+        // sonuç iş parçacığı sayısından bağımsız olarak yalnızca seed'e bağlıdır.
+        static void fill_parallel(std::uint64_t seed, int min_year, int max_year,
+                                  SerialDate* out, std::size_t count, unsigned threads = 0);
+        static void fill_parallel(std::uint64_t seed, int min_year, int max_year,
+                                  Date* out, std::size_t count, unsigned threads = 0);
+
+    private:
+        // [0, m_range) aralığında sapmasız sayı (Lemire'ın çarpma yöntemi).
+        std::uint32_t bounded() noexcept {
+            std::uint64_t m = (m_engine() >> 32) * m_range;
+            if (static_cast<std::uint32_t>(m) < m_range) {
+                const std::uint32_t threshold = static_cast<std::uint32_t>(-m_range) % m_range;
+                while (static_cast<std::uint32_t>(m) < threshold) {
+                    m = (m_engine() >> 32) * m_range;
+                }
+            }
+            return static_cast<std::uint32_t>(m >> 32);
+        }
+
+        Xoshiro256 m_engine;
+        std::int32_t m_first;
+        std::uint32_t m_range;
+    };
+}
+
+#endif
@@ -0,0 +1,224 @@
+#ifndef DATE_RANGE_H
+#define DATE_RANGE_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include "date.h"
+#include "date_civil.h"
+
+namespace project {
+    enum class DateUnit { days, weeks, months, years };
+
+    struct DateStep {
+        int count = 1;
+        DateUnit unit = DateUnit::days;
+
+        [[nodiscard]] static constexpr DateStep days(int n = 1) noexcept { return { n, DateUnit::days }; }
+        [[nodiscard]] static constexpr DateStep weeks(int n = 1) noexcept { return { n, DateUnit::weeks }; }
+        [[nodiscard]] static constexpr DateStep months(int n = 1) noexcept { return { n, DateUnit::months }; }
+        [[nodiscard]] static constexpr DateStep years(int n = 1) noexcept { return { n, DateUnit::years }; }
+    };
+
+    // [first, last) aralığındaki tarihleri step adımlarıyla gezen, bellek
+    // ayırmayan görünüm. Ay ve yıl adımları her zaman ilk tarihin gününden
+    // hesaplanır ve ay sonuna kırpılır (31 Ocak, 29 Şubat, 31 Mart, ...).
+    class DateRange {
+    public:
+        // Rastgele erişimli yineleyici; std::views::iota gibi değer döndürür.
+        class iterator {
+        public:
+            using value_type = Date;
+            using reference = Date;
+            using pointer = void;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::input_iterator_tag;
+            using iterator_concept = std::random_access_iterator_tag;
+
+            constexpr iterator() noexcept = default;
+
+            [[nodiscard]] constexpr Date operator*() const noexcept { return Date::from_civil(m_date); }
+            [[nodiscard]] constexpr Date operator[](difference_type n) const noexcept { return *(*this + n); }
+
+            // Tek adım: gün/hafta için ay taşması, ay/yıl için ay indeksi
+            constexpr iterator& operator++() noexcept {
+                ++m_index;
+                if (m_stride_months != 0) {
+                    m_date = civil::add_months({ m_anchor_day, m_date.month, m_date.year }, m_stride_months);
+                } else if (m_stride_days <= 28) {
+                    m_date.day += m_stride_days;
+                    const int max_day = civil::days_in_month(m_date.month, m_date.year);
+                    if (m_date.day > max_day) {
+                        m_date.day -= max_day;
+                        if (++m_date.month > 12) {
+                            m_date.month = 1;
+                            ++m_date.year;
+                        }
+                    }
+                } else {
+                    advance(1);
+                }
+                return *this;
+            }
+
+            constexpr iterator operator++(int) noexcept {
+                iterator temp{ *this };
+                ++*this;
+                return temp;
+            }
+
+            constexpr iterator& operator--() noexcept { return *this -= 1; }
+
+            constexpr iterator operator--(int) noexcept {
+                iterator temp{ *this };
+                --*this;
+                return temp;
+            }
+
+            constexpr iterator& operator+=(difference_type n) noexcept {
+                m_index += n;
+                advance(n);
+                return *this;
+            }
+
+            constexpr iterator& operator-=(difference_type n) noexcept { return *this += -n; }
+
+            [[nodiscard]] friend constexpr iterator operator+(iterator it, difference_type n) noexcept { return it += n; }
+            [[nodiscard]] friend constexpr iterator operator+(difference_type n, iterator it) noexcept { return it += n; }
+            [[nodiscard]] friend constexpr iterator operator-(iterator it, difference_type n) noexcept { return it -= n; }
+            [[nodiscard]] friend constexpr difference_type operator-(const iterator& a, const iterator& b) noexcept {
+                return a.m_index - b.m_index;
+            }
+
+            // Aynı aralıktan gelen yineleyiciler sıra numarasıyla karşılaştırılır
+            [[nodiscard]] friend constexpr bool operator==(const iterator& a, const iterator& b) noexcept { return a.m_index == b.m_index; }
+            [[nodiscard]] friend constexpr bool operator!=(const iterator& a, const iterator& b) noexcept { return a.m_index != b.m_index; }
+            [[nodiscard]] friend constexpr bool operator<(const iterator& a, const iterator& b) noexcept { return a.m_index < b.m_index; }
+            [[nodiscard]] friend constexpr bool operator>(const iterator& a, const iterator& b) noexcept { return a.m_index > b.m_index; }
+            [[nodiscard]] friend constexpr bool operator<=(const iterator& a, const iterator& b) noexcept { return a.m_index <= b.m_index; }
+            [[nodiscard]] friend constexpr bool operator>=(const iterator& a, const iterator& b) noexcept { return a.m_index >= b.m_index; }
+
+        private:
+            friend class DateRange;
+
+            constexpr iterator(const civil::CivilDate& first, DateStep step) noexcept
+                : m_date(first), m_anchor_day(first.day) {
+                switch (step.unit) {
+                    case DateUnit::days:   m_stride_days = step.count; break;
+                    case DateUnit::weeks:  m_stride_days = step.count * 7; break;
+                    case DateUnit::months: m_stride_months = step.count; break;
+                    case DateUnit::years:  m_stride_months = step.count * 12; break;
+                }
+            }
+
+            // n adım ileri/geri: tek bir seri ya da ay indeksi dönüşümü
+            constexpr void advance(difference_type n) noexcept {
+                if (m_stride_months != 0) {
+                    m_date = civil::add_months({ m_anchor_day, m_date.month, m_date.year },
+                                               static_cast<int>(n * m_stride_months));
+                } else {
+                    m_date = civil::civil_from_days(
+                        civil::days_from_civil(m_date.day, m_date.month, m_date.year) +
+                        static_cast<int>(n * m_stride_days));
+                }
+            }
+
+            civil::CivilDate m_date{ 1, 1, Date::year_base };
+            difference_type m_index = 0;
+            int m_anchor_day = 1;
+            int m_stride_days = 0;     // gün/hafta adımı
+            int m_stride_months = 0;   // ay/yıl adımı
+        };
+
+        using const_iterator = iterator;
+
+        constexpr DateRange() noexcept = default;
+
+        constexpr DateRange(const Date& first, const Date& last, DateStep step = DateStep::days())
+            : m_begin(to_civil(first), check_step(step)), m_size(count(first, last, step)) {}
+
+        [[nodiscard]] constexpr iterator begin() const noexcept { return m_begin; }
+        [[nodiscard]] constexpr iterator end() const noexcept { return m_begin + static_cast<std::ptrdiff_t>(m_size); }
+        [[nodiscard]] constexpr std::size_t size() const noexcept { return m_size; }
+        [[nodiscard]] constexpr bool empty() const noexcept { return m_size == 0; }
+
+        [[nodiscard]] constexpr Date operator[](std::size_t n) const noexcept {
+            return m_begin[static_cast<std::ptrdiff_t>(n)];
+        }
+        [[nodiscard]] constexpr Date front() const noexcept { return *m_begin; }
+        [[nodiscard]] constexpr Date back() const noexcept { return (*this)[m_size - 1]; }
+
+        // [from, to) elemanları; ay adımlarında ilk tarihin günü korunur.
+        [[nodiscard]] constexpr DateRange slice(std::size_t from, std::size_t to) const noexcept {
+            if (to > m_size) {
+                to = m_size;
+            }
+            if (from > to) {
+                from = to;
+            }
+            return DateRange(m_begin + static_cast<std::ptrdiff_t>(from), to - from);
+        }
+
+    private:
+        constexpr DateRange(iterator first, std::size_t size) noexcept
+            : m_begin(first), m_size(size) {
+            m_begin.m_index = 0;
+        }
+
+        static constexpr civil::CivilDate to_civil(const Date& date) noexcept {
+            return { date.get_month_day(), date.get_month(), date.get_year() };
+        }
+
+        static constexpr DateStep check_step(DateStep step) {
+            if (step.count <= 0) {
+                throw std::invalid_argument("Adim pozitif olmalidir");
+            }
+            return step;
+        }
+
+        // Eleman sayısı, gezinmeden hesaplanır.
+        static constexpr std::size_t count(const Date& first, const Date& last, DateStep step) noexcept {
+            if (!(first < last)) {
+                return 0;
+            }
+            if (step.unit == DateUnit::days || step.unit == DateUnit::weeks) {
+                const long long stride = step.unit == DateUnit::weeks ? step.count * 7LL : step.count;
+                const long long span = last.get_day_serial() - first.get_day_serial();
+                return static_cast<std::size_t>((span + stride - 1) / stride);
+            }
+
+            const long long stride = step.unit == DateUnit::years ? step.count * 12LL : step.count;
+            const long long months = (last.get_year() - first.get_year()) * 12LL + (last.get_month() - first.get_month());
+            // months / stride adıma kadar olanlar last'ın ayından önce kalır
+            std::size_t n = static_cast<std::size_t>((months + stride - 1) / stride);
+            if (months % stride == 0) {
+                const int max_day = civil::days_in_month(last.get_month(), last.get_year());
+                const int day = first.get_month_day() < max_day ? first.get_month_day() : max_day;
+                if (day < last.get_month_day()) {
+                    ++n;
+                }
+            }
+            return n;
+        }
+
+        iterator m_begin;
+        std::size_t m_size = 0;
+    };
+
+    [[nodiscard]] constexpr DateRange date_range(const Date& first, const Date& last,
+                                                 DateStep step = DateStep::days()) {
+        return DateRange(first, last, step);
+    }
+}
+
+#if defined(__cpp_lib_ranges)
+#include <ranges>
+
+// Görünüm ucuz kopyalanır ve yineleyicileri nesneden bağımsızdır.
+template <>
+inline constexpr bool std::ranges::enable_view<project::DateRange> = true;
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<project::DateRange> = true;
+#endif
+
+#endif
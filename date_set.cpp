@@ -0,0 +1,426 @@
+#include "date_set.h"
+#include <algorithm>
+
+namespace project {
+
+    // Helper functions
+    namespace {
+        constexpr int block_words = DateSet::block_days / 64;
+        // Bu sayıda günden sonra dizi bitmap'ten büyük olur (2 x 64 = 128 bayt)
+        constexpr int max_array = DateSet::block_days / 16;
+
+        void store_word(std::uint16_t* data, int i, std::uint64_t word) noexcept {
+            std::memcpy(data + i * 4, &word, sizeof(word));
+        }
+
+        // [first, last) bitlerini kurar
+        void set_range(std::uint64_t* words, int first, int last) noexcept {
+            for (int w = first >> 6; w <= (last - 1) >> 6; ++w) {
+                const int lo = std::max(first - w * 64, 0);
+                const int hi = std::min(last - w * 64, 64);
+                words[w] |= bits::low_mask(hi) & ~bits::low_mask(lo);
+            }
+        }
+
+        // pos'tan itibaren ilk kurulu (set) ya da boş bit; yoksa block_days
+        int next_bit(const std::uint64_t* words, int pos, bool set) noexcept {
+            if (pos >= DateSet::block_days) {
+                return DateSet::block_days;
+            }
+            int w = pos >> 6;
+            std::uint64_t word = (set ? words[w] : ~words[w]) & ~bits::low_mask(pos & 63);
+            while (word == 0) {
+                if (++w == block_words) {
+                    return DateSet::block_days;
+                }
+                word = set ? words[w] : ~words[w];
+            }
+            return w * 64 + bits::countr_zero(word);
+        }
+
+        std::int32_t key_of(SerialDate date) noexcept {
+            return date.serial() >> DateSet::block_bits;
+        }
+
+        int low_of(SerialDate date) noexcept {
+            return date.serial() & (DateSet::block_days - 1);
+        }
+    }
+
+    // Constructors
+    DateSet::DateSet(const SerialDate* dates, std::size_t count) {
+        std::vector<std::int32_t> serials(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            serials[i] = dates[i].serial();
+        }
+        std::sort(serials.begin(), serials.end());
+        assign_sorted(serials.data(), serials.size());
+    }
+
+    DateSet::DateSet(const Date* dates, std::size_t count) {
+        std::vector<std::int32_t> serials(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            serials[i] = dates[i].get_day_serial();
+        }
+        std::sort(serials.begin(), serials.end());
+        assign_sorted(serials.data(), serials.size());
+    }
+
+    void DateSet::assign_sorted(const std::int32_t* serials, std::size_t count) {
+        for (std::size_t i = 0; i < count;) {
+            const std::int32_t key = key_of(SerialDate::from_serial(serials[i]));
+            std::uint64_t words[block_words] = {};
+            for (; i < count && key_of(SerialDate::from_serial(serials[i])) == key; ++i) {
+                const int low = low_of(SerialDate::from_serial(serials[i]));
+                words[low >> 6] |= std::uint64_t{ 1 } << (low & 63);
+            }
+            Block block{ key, Kind::array, 0, {} };
+            m_size += encode(block, words);
+            m_blocks.push_back(std::move(block));
+        }
+        m_blocks.shrink_to_fit();
+    }
+
+    // Block encoding
+    void DateSet::decode(const Block& block, std::uint64_t* words) noexcept {
+        const std::uint16_t* data = block.data.data();
+        switch (block.kind) {
+            case Kind::array:
+                std::fill(words, words + block_words, 0);
+                for (int i = 0; i < block.count; ++i) {
+                    words[data[i] >> 6] |= std::uint64_t{ 1 } << (data[i] & 63);
+                }
+                break;
+            case Kind::run:
+                std::fill(words, words + block_words, 0);
+                for (std::size_t i = 0; i < block.data.size(); i += 2) {
+                    set_range(words, data[i], data[i + 1] + 1);
+                }
+                break;
+            case Kind::bitmap:
+                for (int w = 0; w < block_words; ++w) {
+                    words[w] = load_word(data, w);
+                }
+                break;
+        }
+    }
+
+    int DateSet::encode(Block& block, const std::uint64_t* words) {
+        int count = 0;
+        int runs = 0;
+        std::uint64_t carry = 0;   // önceki kelimenin son biti
+        for (int w = 0; w < block_words; ++w) {
+            count += bits::popcount(words[w]);
+            runs += bits::popcount(words[w] & ~((words[w] << 1) | carry));
+            carry = words[w] >> 63;
+        }
+        if (count == 0) {
+            return 0;
+        }
+
+        // En küçük gösterim; eşitlikte dizi, sonra bitmap
+        std::vector<std::uint16_t> data;
+        if (runs * 2 < std::min(count, max_array)) {
+            block.kind = Kind::run;
+            data.resize(static_cast<std::size_t>(runs) * 2);
+            std::size_t n = 0;
+            for (int first = next_bit(words, 0, true); first < block_days; ) {
+                const int last = next_bit(words, first, false);
+                data[n++] = static_cast<std::uint16_t>(first);
+                data[n++] = static_cast<std::uint16_t>(last - 1);
+                first = next_bit(words, last, true);
+            }
+        } else if (count <= max_array) {
+            block.kind = Kind::array;
+            data.resize(static_cast<std::size_t>(count));
+            std::size_t n = 0;
+            for (int w = 0; w < block_words; ++w) {
+                for (std::uint64_t word = words[w]; word != 0; word &= word - 1) {
+                    data[n++] = static_cast<std::uint16_t>(w * 64 + bits::countr_zero(word));
+                }
+            }
+        } else {
+            block.kind = Kind::bitmap;
+            data.resize(block_words * 4);
+            for (int w = 0; w < block_words; ++w) {
+                store_word(data.data(), w, words[w]);
+            }
+        }
+        block.count = static_cast<std::uint16_t>(count);
+        block.data = std::move(data);
+        return count;
+    }
+
+    std::size_t DateSet::lower_block(std::int32_t key) const noexcept {
+        std::size_t lo = 0;
+        std::size_t hi = m_blocks.size();
+        while (lo < hi) {
+            const std::size_t mid = (lo + hi) / 2;
+            if (m_blocks[mid].key < key) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    // Modifiers
+    bool DateSet::insert(SerialDate date) {
+        if (contains(date)) {
+            return false;
+        }
+        const std::int32_t key = key_of(date);
+        const int low = low_of(date);
+        const std::size_t b = lower_block(key);
+        if (b == m_blocks.size() || m_blocks[b].key != key) {
+            m_blocks.insert(m_blocks.begin() + b,
+                            Block{ key, Kind::array, 1, { static_cast<std::uint16_t>(low) } });
+        } else {
+            std::uint64_t words[block_words];
+            decode(m_blocks[b], words);
+            words[low >> 6] |= std::uint64_t{ 1 } << (low & 63);
+            encode(m_blocks[b], words);
+        }
+        ++m_size;
+        return true;
+    }
+
+    void DateSet::insert_range(SerialDate from, SerialDate to) {
+        if (to <= from) {
+            return;
+        }
+        const std::int32_t last_key = key_of(to - 1);
+        for (std::int32_t key = key_of(from); key <= last_key; ++key) {
+            const SerialDate::rep base = key * block_days;
+            const int first = std::max(from.serial(), base) - base;
+            // Son blokta base + block_days int32'yi aşar
+            const int last = static_cast<int>(std::min<long long>(to.serial(), static_cast<long long>(base) + block_days) - base);
+
+            std::uint64_t words[block_words] = {};
+            std::size_t b = lower_block(key);
+            const bool found = b < m_blocks.size() && m_blocks[b].key == key;
+            if (found) {
+                decode(m_blocks[b], words);
+                m_size -= m_blocks[b].count;
+            } else {
+                m_blocks.insert(m_blocks.begin() + b, Block{ key, Kind::array, 0, {} });
+            }
+            set_range(words, first, last);
+            m_size += encode(m_blocks[b], words);
+        }
+    }
+
+    bool DateSet::erase(SerialDate date) {
+        if (!contains(date)) {
+            return false;
+        }
+        const std::size_t b = lower_block(key_of(date));
+        const int low = low_of(date);
+        std::uint64_t words[block_words];
+        decode(m_blocks[b], words);
+        words[low >> 6] &= ~(std::uint64_t{ 1 } << (low & 63));
+        if (encode(m_blocks[b], words) == 0) {
+            m_blocks.erase(m_blocks.begin() + b);
+        }
+        --m_size;
+        return true;
+    }
+
+    void DateSet::clear() noexcept {
+        m_blocks.clear();
+        m_size = 0;
+    }
+
+    // Queries
+    bool DateSet::contains(SerialDate date) const noexcept {
+        const std::int32_t key = key_of(date);
+        const std::size_t b = lower_block(key);
+        if (b == m_blocks.size() || m_blocks[b].key != key) {
+            return false;
+        }
+        const Block& block = m_blocks[b];
+        const std::uint16_t* data = block.data.data();
+        const int low = low_of(date);
+        switch (block.kind) {
+            case Kind::array:
+                return std::binary_search(data, data + block.count, low);
+            case Kind::run: {
+                // low'dan büyük ilk başlangıç; önceki run low'u kapsamalı
+                std::size_t lo = 0;
+                std::size_t hi = block.data.size() / 2;
+                while (lo < hi) {
+                    const std::size_t mid = (lo + hi) / 2;
+                    if (data[mid * 2] <= low) {
+                        lo = mid + 1;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                return lo != 0 && low <= data[lo * 2 - 1];
+            }
+            case Kind::bitmap:
+                return (load_word(data, low >> 6) >> (low & 63)) & 1;
+        }
+        return false;
+    }
+
+    std::size_t DateSet::memory_usage() const noexcept {
+        std::size_t bytes = sizeof(DateSet) + m_blocks.capacity() * sizeof(Block);
+        for (const Block& block : m_blocks) {
+            bytes += block.data.capacity() * sizeof(std::uint16_t);
+        }
+        return bytes;
+    }
+
+    // Set operations
+    DateSet DateSet::combine(const DateSet& a, const DateSet& b, Op op) {
+        DateSet result;
+        result.m_blocks.reserve(op == Op::unite ? a.m_blocks.size() + b.m_blocks.size() : a.m_blocks.size());
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while (i < a.m_blocks.size() || j < b.m_blocks.size()) {
+            if (j == b.m_blocks.size() || (i < a.m_blocks.size() && a.m_blocks[i].key < b.m_blocks[j].key)) {
+                if (op != Op::intersect) {
+                    result.m_blocks.push_back(a.m_blocks[i]);
+                    result.m_size += a.m_blocks[i].count;
+                }
+                ++i;
+            } else if (i == a.m_blocks.size() || b.m_blocks[j].key < a.m_blocks[i].key) {
+                if (op == Op::unite) {
+                    result.m_blocks.push_back(b.m_blocks[j]);
+                    result.m_size += b.m_blocks[j].count;
+                }
+                ++j;
+            } else {
+                std::uint64_t x[block_words];
+                std::uint64_t y[block_words];
+                decode(a.m_blocks[i], x);
+                decode(b.m_blocks[j], y);
+                for (int w = 0; w < block_words; ++w) {
+                    switch (op) {
+                        case Op::unite:     x[w] |= y[w]; break;
+                        case Op::intersect: x[w] &= y[w]; break;
+                        case Op::subtract:  x[w] &= ~y[w]; break;
+                    }
+                }
+                Block block{ a.m_blocks[i].key, Kind::array, 0, {} };
+                const int count = encode(block, x);
+                if (count != 0) {
+                    result.m_blocks.push_back(std::move(block));
+                    result.m_size += count;
+                }
+                ++i;
+                ++j;
+            }
+        }
+        result.m_blocks.shrink_to_fit();
+        return result;
+    }
+
+    std::size_t intersection_size(const DateSet& a, const DateSet& b) noexcept {
+        std::size_t count = 0;
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while (i < a.m_blocks.size() && j < b.m_blocks.size()) {
+            if (a.m_blocks[i].key < b.m_blocks[j].key) {
+                ++i;
+            } else if (b.m_blocks[j].key < a.m_blocks[i].key) {
+                ++j;
+            } else {
+                std::uint64_t x[block_words];
+                std::uint64_t y[block_words];
+                DateSet::decode(a.m_blocks[i], x);
+                DateSet::decode(b.m_blocks[j], y);
+                for (int w = 0; w < block_words; ++w) {
+                    count += static_cast<std::size_t>(bits::popcount(x[w] & y[w]));
+                }
+                ++i;
+                ++j;
+            }
+        }
+        return count;
+    }
+
+    bool operator==(const DateSet& a, const DateSet& b) noexcept {
+        // Gösterim içerikten belirlendiği için bloklar birebir karşılaştırılır
+        if (a.m_size != b.m_size || a.m_blocks.size() != b.m_blocks.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < a.m_blocks.size(); ++i) {
+            const DateSet::Block& x = a.m_blocks[i];
+            const DateSet::Block& y = b.m_blocks[i];
+            if (x.key != y.key || x.kind != y.kind || x.count != y.count || x.data != y.data) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Iterator
+    DateSet::iterator::iterator(const DateSet* set, std::size_t block) noexcept : m_set(set), m_block(block) {
+        load();
+    }
+
+    void DateSet::iterator::load() noexcept {
+        m_pos = 0;
+        m_low = 0;
+        if (m_block >= m_set->m_blocks.size()) {
+            m_block = m_set->m_blocks.size();
+            return;
+        }
+        const Block& block = m_set->m_blocks[m_block];
+        if (block.kind == Kind::bitmap) {
+            int w = 0;
+            std::uint64_t word;
+            while ((word = load_word(block.data.data(), w)) == 0) {
+                ++w;
+            }
+            m_low = w * 64 + bits::countr_zero(word);
+        } else {
+            m_low = block.data[0];
+        }
+    }
+
+    SerialDate DateSet::iterator::serial_date() const noexcept {
+        return SerialDate::from_serial(m_set->m_blocks[m_block].key * block_days + m_low);
+    }
+
+    DateSet::iterator& DateSet::iterator::operator++() noexcept {
+        const Block& block = m_set->m_blocks[m_block];
+        const std::uint16_t* data = block.data.data();
+        switch (block.kind) {
+            case Kind::array:
+                if (++m_pos < block.count) {
+                    m_low = data[m_pos];
+                    return *this;
+                }
+                break;
+            case Kind::run:
+                if (m_low < data[m_pos * 2 + 1]) {
+                    ++m_low;
+                    return *this;
+                }
+                if (static_cast<std::size_t>(++m_pos) * 2 < block.data.size()) {
+                    m_low = data[m_pos * 2];
+                    return *this;
+                }
+                break;
+            case Kind::bitmap: {
+                int pos = m_low + 1;
+                while (pos < block_days) {
+                    const std::uint64_t word = load_word(data, pos >> 6) & ~bits::low_mask(pos & 63);
+                    if (word != 0) {
+                        m_low = (pos & ~63) + bits::countr_zero(word);
+                        return *this;
+                    }
+                    pos = (pos & ~63) + 64;
+                }
+                break;
+            }
+        }
+        ++m_block;
+        load();
+        return *this;
+    }
+}
@@ -0,0 +1,174 @@
+#ifndef DATE_SET_H
+#define DATE_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <vector>
+#include "date.h"
+#include "date_bits.h"
+#include "serial_date.h"
+
+namespace project {
+
+    // Sıkıştırılmış gün kümesi (roaring bitmap düzeni). Seri numaraları
+    // 1024 günlük (~2.8 yıl) bloklara ayrılır; her blok içeriğine göre en
+    // küçük gösterimde tutulur:
+    //   array  : sıralı 16 bitlik gün konumları (en fazla 64 gün)
+    //   bitmap : 1024 bit (128 bayt)
+    //   run    : (ilk, son) çiftleri; yoğun ardışık aralıklar için
+    // Gösterim içerikten belirlendiği için aynı küme her zaman aynı biçimde
+    // saklanır. Üyelik bloğu birkaç anahtar üzerinde ikili aramayla bulur,
+    // blok içinde bit testi ya da en fazla 6 adımlık arama yapar. Küme
+    // işlemleri blokları 16 kelimelik bitmap'lere açıp kelime kelime
+    // birleştirir; eleman sayısı popcount ile bulunur.
+    class DateSet {
+    public:
+        static constexpr int block_bits = 10;
+        static constexpr int block_days = 1 << block_bits;
+
+        // Küçükten büyüğe Date üretir; küme değişirse geçersizleşir.
+        class iterator {
+        public:
+            using value_type = Date;
+            using reference = Date;
+            using pointer = void;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+            iterator() noexcept = default;
+
+            [[nodiscard]] Date operator*() const noexcept { return serial_date().to_date(); }
+            [[nodiscard]] SerialDate serial_date() const noexcept;
+            iterator& operator++() noexcept;
+            iterator operator++(int) noexcept {
+                iterator temp{ *this };
+                ++*this;
+                return temp;
+            }
+            [[nodiscard]] friend bool operator==(const iterator& a, const iterator& b) noexcept {
+                return a.m_block == b.m_block && a.m_pos == b.m_pos && a.m_low == b.m_low;
+            }
+            [[nodiscard]] friend bool operator!=(const iterator& a, const iterator& b) noexcept { return !(a == b); }
+
+        private:
+            friend class DateSet;
+
+            iterator(const DateSet* set, std::size_t block) noexcept;
+            void load() noexcept;
+
+            const DateSet* m_set = nullptr;
+            std::size_t m_block = 0;
+            int m_pos = 0;   // array/run: eleman ya da run sırası
+            int m_low = 0;   // blok içindeki gün
+        };
+
+        // Constructors
+        DateSet() = default;
+        // Sırasız girdi; tekrarlar bir kez sayılır.
+        DateSet(const SerialDate* dates, std::size_t count);
+        DateSet(const Date* dates, std::size_t count);
+
+        // Modifiers
+        bool insert(SerialDate date);
+        bool insert(const Date& date) { return insert(SerialDate{ date }); }
+        // [from, to) aralığındaki tüm günler
+        void insert_range(SerialDate from, SerialDate to);
+        void insert_range(const Date& from, const Date& to) { insert_range(SerialDate{ from }, SerialDate{ to }); }
+        bool erase(SerialDate date);
+        bool erase(const Date& date) { return erase(SerialDate{ date }); }
+        void clear() noexcept;
+
+        // Queries
+        [[nodiscard]] bool contains(SerialDate date) const noexcept;
+        [[nodiscard]] bool contains(const Date& date) const noexcept { return contains(SerialDate{ date }); }
+        [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+        [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+        // Nesne dahil ayrılmış toplam bayt
+        [[nodiscard]] std::size_t memory_usage() const noexcept;
+
+        [[nodiscard]] iterator begin() const noexcept { return iterator(this, 0); }
+        [[nodiscard]] iterator end() const noexcept { return iterator(this, m_blocks.size()); }
+
+        // f(SerialDate) küçükten büyüğe; yineleyiciden hızlıdır.
+        template <typename F>
+        void for_each(F f) const;
+
+        // Set operations
+        [[nodiscard]] friend DateSet operator|(const DateSet& a, const DateSet& b) { return combine(a, b, Op::unite); }
+        [[nodiscard]] friend DateSet operator&(const DateSet& a, const DateSet& b) { return combine(a, b, Op::intersect); }
+        [[nodiscard]] friend DateSet operator-(const DateSet& a, const DateSet& b) { return combine(a, b, Op::subtract); }
+        DateSet& operator|=(const DateSet& other) { return *this = *this | other; }
+        DateSet& operator&=(const DateSet& other) { return *this = *this & other; }
+        DateSet& operator-=(const DateSet& other) { return *this = *this - other; }
+
+        // |a & b|, kesişim kümesi oluşturulmadan
+        friend std::size_t intersection_size(const DateSet& a, const DateSet& b) noexcept;
+
+        friend bool operator==(const DateSet& a, const DateSet& b) noexcept;
+        [[nodiscard]] friend bool operator!=(const DateSet& a, const DateSet& b) noexcept { return !(a == b); }
+
+    private:
+        enum class Kind : std::uint8_t { array, bitmap, run };
+        enum class Op { unite, intersect, subtract };
+
+        struct Block {
+            std::int32_t key;                 // seri >> block_bits
+            Kind kind;
+            std::uint16_t count;              // 1..block_days
+            std::vector<std::uint16_t> data;  // bitmap: 64 x 16 bit
+        };
+
+        static DateSet combine(const DateSet& a, const DateSet& b, Op op);
+        void assign_sorted(const std::int32_t* serials, std::size_t count);
+        // key'e sahip ya da ondan sonraki ilk bloğun sırası
+        [[nodiscard]] std::size_t lower_block(std::int32_t key) const noexcept;
+        static void decode(const Block& block, std::uint64_t* words) noexcept;
+        // words boşsa 0 döndürür ve block'a dokunmaz
+        static int encode(Block& block, const std::uint64_t* words);
+
+        static std::uint64_t load_word(const std::uint16_t* data, int i) noexcept {
+            std::uint64_t word;
+            std::memcpy(&word, data + i * 4, sizeof(word));
+            return word;
+        }
+
+        std::vector<Block> m_blocks;   // anahtara göre sıralı
+        std::size_t m_size = 0;
+    };
+
+    [[nodiscard]] std::size_t intersection_size(const DateSet& a, const DateSet& b) noexcept;
+    [[nodiscard]] bool operator==(const DateSet& a, const DateSet& b) noexcept;
+
+    template <typename F>
+    void DateSet::for_each(F f) const {
+        for (const Block& block : m_blocks) {
+            const int base = block.key * block_days;
+            const std::uint16_t* data = block.data.data();
+            switch (block.kind) {
+                case Kind::array:
+                    for (int i = 0; i < block.count; ++i) {
+                        f(SerialDate::from_serial(base + data[i]));
+                    }
+                    break;
+                case Kind::run:
+                    for (std::size_t i = 0; i < block.data.size(); i += 2) {
+                        for (int low = data[i]; low <= data[i + 1]; ++low) {
+                            f(SerialDate::from_serial(base + low));
+                        }
+                    }
+                    break;
+                case Kind::bitmap:
+                    for (int w = 0; w < block_days / 64; ++w) {
+                        for (std::uint64_t word = load_word(data, w); word != 0; word &= word - 1) {
+                            f(SerialDate::from_serial(base + w * 64 + bits::countr_zero(word)));
+                        }
+                    }
+                    break;
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef DATE_SIMD_H
+#define DATE_SIMD_H
+
+// Toplu çekirdeklerin kullandığı SIMD yardımcıları. x86 üzerinde GCC/Clang
+// ile SSE4.1/AVX2 kodu fonksiyon bazında derlenir ve çalışma anında CPU
+// desteğine göre seçilir; diğer ortamlarda skaler yol kullanılır.
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PROJECT_DATE_X86_DISPATCH 1
+#define PROJECT_DATE_TARGET(isa) __attribute__((target(isa)))
+#include <immintrin.h>
+#else
+#define PROJECT_DATE_X86_DISPATCH 0
+#define PROJECT_DATE_TARGET(isa)
+#endif
+
+#include <atomic>
+
+namespace project::simd {
+
+    enum class Level { scalar, sse41, avx2 };
+
+    inline Level detect_level() noexcept {
+#if PROJECT_DATE_X86_DISPATCH
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return Level::avx2;
+        }
+        if (__builtin_cpu_supports("sse4.1")) {
+            return Level::sse41;
+        }
+#endif
+        return Level::scalar;
+    }
+
+    // CPU tespiti bir kez yapılır.
+    inline Level cpu_level() noexcept {
+        static const Level level = detect_level();
+        return level;
+    }
+
+    inline std::atomic<int>& level_limit() noexcept {
+        static std::atomic<int> limit{ static_cast<int>(Level::avx2) };
+        return limit;
+    }
+
+    // Kullanılacak en yüksek seviyeyi sınırlar (ölçüm ve karşılaştırma için).
+    inline void limit_level(Level max) noexcept {
+        level_limit().store(static_cast<int>(max), std::memory_order_relaxed);
+    }
+
+    // Toplu çekirdeklerin kullandığı seviye: CPU desteği ile sınırın küçüğü.
+    inline Level active_level() noexcept {
+        const int limit = level_limit().load(std::memory_order_relaxed);
+        const Level level = cpu_level();
+        return static_cast<int>(level) < limit ? level : static_cast<Level>(limit);
+    }
+}
+
+#endif
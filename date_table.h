@@ -0,0 +1,316 @@
+#ifndef DATE_TABLE_H
+#define DATE_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "date.h"
+#include "serial_date.h"
+
+namespace project {
+    // [first, last] penceresindeki her gün için bir değer tutan dizi. Anahtar
+    // gün ofsetidir; arama tek çıkarma ve dizi erişimidir. Günlük sayımlar
+    // gibi yoğun, sınırlı aralıklı veriler içindir.
+    template <typename T>
+    class DenseDayTable {
+    public:
+        DenseDayTable(SerialDate first, SerialDate last, const T& value = T{})
+            : m_first(first.serial()),
+              m_values(last < first ? 0 : static_cast<std::size_t>(last - first) + 1, value) {}
+        DenseDayTable(const Date& first, const Date& last, const T& value = T{})
+            : DenseDayTable(SerialDate{ first }, SerialDate{ last }, value) {}
+
+        [[nodiscard]] bool contains(SerialDate date) const noexcept {
+            const std::int64_t offset = static_cast<std::int64_t>(date.serial()) - m_first;
+            return offset >= 0 && static_cast<std::uint64_t>(offset) < m_values.size();
+        }
+        [[nodiscard]] bool contains(const Date& date) const noexcept { return contains(SerialDate{ date }); }
+
+        // Denetimsiz erişim; tarih pencere içinde olmalıdır.
+        [[nodiscard]] T& operator[](SerialDate date) noexcept { return m_values[offset(date)]; }
+        [[nodiscard]] const T& operator[](SerialDate date) const noexcept { return m_values[offset(date)]; }
+        [[nodiscard]] T& operator[](const Date& date) noexcept { return (*this)[SerialDate{ date }]; }
+        [[nodiscard]] const T& operator[](const Date& date) const noexcept { return (*this)[SerialDate{ date }]; }
+
+        // Pencere dışı tarihler için std::out_of_range
+        [[nodiscard]] T& at(SerialDate date) { check(date); return (*this)[date]; }
+        [[nodiscard]] const T& at(SerialDate date) const { check(date); return (*this)[date]; }
+        [[nodiscard]] T& at(const Date& date) { return at(SerialDate{ date }); }
+        [[nodiscard]] const T& at(const Date& date) const { return at(SerialDate{ date }); }
+
+        [[nodiscard]] SerialDate first() const noexcept { return SerialDate::from_serial(m_first); }
+        [[nodiscard]] SerialDate last() const noexcept {
+            return SerialDate::from_serial(m_first + static_cast<SerialDate::rep>(m_values.size()) - 1);
+        }
+        [[nodiscard]] std::size_t size() const noexcept { return m_values.size(); }
+
+        // Değerler gün sırasıyla; i. değer first() + i gününe aittir.
+        [[nodiscard]] T* data() noexcept { return m_values.data(); }
+        [[nodiscard]] const T* data() const noexcept { return m_values.data(); }
+        [[nodiscard]] auto begin() noexcept { return m_values.begin(); }
+        [[nodiscard]] auto end() noexcept { return m_values.end(); }
+        [[nodiscard]] auto begin() const noexcept { return m_values.begin(); }
+        [[nodiscard]] auto end() const noexcept { return m_values.end(); }
+
+        // f(SerialDate, T&) gün sırasıyla çağrılır.
+        template <typename F>
+        void for_each(F f) {
+            for (std::size_t i = 0; i < m_values.size(); ++i) {
+                f(SerialDate::from_serial(m_first + static_cast<SerialDate::rep>(i)), m_values[i]);
+            }
+        }
+
+    private:
+        std::size_t offset(SerialDate date) const noexcept {
+            return static_cast<std::size_t>(date.serial() - m_first);
+        }
+
+        void check(SerialDate date) const {
+            if (!contains(date)) {
+                throw std::out_of_range("Tarih tablo araligi disinda");
+            }
+        }
+
+        SerialDate::rep m_first;
+        std::vector<T> m_values;
+    };
+
+    // Seyrek tarih anahtarları için açık adresli (doğrusal yoklamalı) harita.
+    // Anahtarlar ve değerler ayrı dizilerde tutulur; yoklama yalnızca 4
+    // baytlık anahtarlara dokunur. Silme, mezar taşı bırakmadan geri kaydırma
+    // ile yapılır. Ekleme/silme yineleyicileri ve işaretçileri geçersiz kılar.
+    // Boş yuva işareti olan seri numarası da geçerli bir anahtardır; değeri
+    // tablonun dışında, m_values'un son elemanında tutulur.
+    template <typename T>
+    class DateFlatMap {
+    public:
+        struct Entry {
+            SerialDate key;
+            T& value;
+        };
+
+        class iterator {
+        public:
+            using value_type = Entry;
+            using reference = Entry;
+            using pointer = void;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+            iterator() noexcept = default;
+
+            [[nodiscard]] Entry operator*() const noexcept {
+                const SerialDate::rep key = m_slot < m_map->m_keys.size() ? m_map->m_keys[m_slot] : empty_key;
+                return { SerialDate::from_serial(key), m_map->m_values[m_slot] };
+            }
+            iterator& operator++() noexcept {
+                ++m_slot;
+                skip();
+                return *this;
+            }
+            iterator operator++(int) noexcept {
+                iterator temp{ *this };
+                ++*this;
+                return temp;
+            }
+            [[nodiscard]] friend bool operator==(const iterator& a, const iterator& b) noexcept { return a.m_slot == b.m_slot; }
+            [[nodiscard]] friend bool operator!=(const iterator& a, const iterator& b) noexcept { return a.m_slot != b.m_slot; }
+
+        private:
+            friend class DateFlatMap;
+
+            iterator(DateFlatMap* map, std::size_t slot) noexcept : m_map(map), m_slot(slot) { skip(); }
+
+            void skip() noexcept {
+                while (m_slot < m_map->m_keys.size() && m_map->m_keys[m_slot] == empty_key) {
+                    ++m_slot;
+                }
+                if (m_slot == m_map->m_keys.size() && !m_map->m_has_empty_key) {
+                    ++m_slot;
+                }
+            }
+
+            DateFlatMap* m_map = nullptr;
+            std::size_t m_slot = 0;
+        };
+
+        DateFlatMap() = default;
+        explicit DateFlatMap(std::size_t capacity) { reserve(capacity); }
+
+        [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+        [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+        // En az count anahtarı yeniden boyutlandırmadan tutacak kapasite
+        void reserve(std::size_t count) {
+            std::size_t slots = 16;
+            while (slots * 3 / 4 < count) {
+                slots *= 2;
+            }
+            if (slots > m_keys.size()) {
+                rehash(slots);
+            }
+        }
+
+        void clear() noexcept {
+            for (std::size_t i = 0; i < m_keys.size(); ++i) {
+                if (m_keys[i] != empty_key) {
+                    m_keys[i] = empty_key;
+                    m_values[i] = T{};
+                }
+            }
+            if (m_has_empty_key) {
+                m_values[m_keys.size()] = T{};
+                m_has_empty_key = false;
+            }
+            m_size = 0;
+        }
+
+        // Yoksa T{} ile ekler
+        T& operator[](SerialDate date) {
+            if ((m_size + 1) * 4 > m_keys.size() * 3) {
+                rehash(m_keys.empty() ? 16 : m_keys.size() * 2);
+            }
+            if (date.serial() == empty_key) {
+                if (!m_has_empty_key) {
+                    m_has_empty_key = true;
+                    ++m_size;
+                }
+                return m_values[m_keys.size()];
+            }
+            std::size_t slot = home(date.serial());
+            while (m_keys[slot] != empty_key) {
+                if (m_keys[slot] == date.serial()) {
+                    return m_values[slot];
+                }
+                slot = (slot + 1) & m_mask;
+            }
+            m_keys[slot] = date.serial();
+            ++m_size;
+            return m_values[slot];
+        }
+        T& operator[](const Date& date) { return (*this)[SerialDate{ date }]; }
+
+        [[nodiscard]] T* find(SerialDate date) noexcept {
+            const std::size_t slot = locate(date.serial());
+            return slot != npos ? &m_values[slot] : nullptr;
+        }
+        [[nodiscard]] const T* find(SerialDate date) const noexcept {
+            const std::size_t slot = locate(date.serial());
+            return slot != npos ? &m_values[slot] : nullptr;
+        }
+        [[nodiscard]] T* find(const Date& date) noexcept { return find(SerialDate{ date }); }
+        [[nodiscard]] const T* find(const Date& date) const noexcept { return find(SerialDate{ date }); }
+        [[nodiscard]] bool contains(SerialDate date) const noexcept { return locate(date.serial()) != npos; }
+        [[nodiscard]] bool contains(const Date& date) const noexcept { return contains(SerialDate{ date }); }
+
+        bool erase(SerialDate date) {
+            std::size_t hole = locate(date.serial());
+            if (hole == npos) {
+                return false;
+            }
+            if (hole == m_keys.size()) {
+                m_values[hole] = T{};
+                m_has_empty_key = false;
+                --m_size;
+                return true;
+            }
+            // Boşluğu, kendi yuvasına boşluktan geçerek ulaşan anahtarlarla doldur
+            std::size_t slot = hole;
+            for (;;) {
+                slot = (slot + 1) & m_mask;
+                if (m_keys[slot] == empty_key) {
+                    break;
+                }
+                const std::size_t ideal = home(m_keys[slot]);
+                if (((slot - ideal) & m_mask) >= ((slot - hole) & m_mask)) {
+                    m_keys[hole] = m_keys[slot];
+                    m_values[hole] = std::move(m_values[slot]);
+                    hole = slot;
+                }
+            }
+            m_keys[hole] = empty_key;
+            m_values[hole] = T{};
+            --m_size;
+            return true;
+        }
+        bool erase(const Date& date) { return erase(SerialDate{ date }); }
+
+        [[nodiscard]] iterator begin() noexcept { return iterator(this, 0); }
+        [[nodiscard]] iterator end() noexcept { return iterator(this, m_keys.size() + 1); }
+
+        // f(SerialDate, T&) yuva sırasıyla (anahtar sırası değil) çağrılır.
+        template <typename F>
+        void for_each(F f) {
+            for (std::size_t i = 0; i < m_keys.size(); ++i) {
+                if (m_keys[i] != empty_key) {
+                    f(SerialDate::from_serial(m_keys[i]), m_values[i]);
+                }
+            }
+            if (m_has_empty_key) {
+                f(SerialDate::from_serial(empty_key), m_values[m_keys.size()]);
+            }
+        }
+
+    private:
+        // Boş yuva işareti
+        static constexpr SerialDate::rep empty_key = std::numeric_limits<SerialDate::rep>::min();
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        // Fibonacci karıştırma: ardışık günler tabloya yayılır
+        std::size_t home(SerialDate::rep key) const noexcept {
+            const std::uint64_t h = static_cast<std::uint32_t>(key) * 0x9E3779B97F4A7C15ull;
+            return static_cast<std::size_t>(h >> 32) & m_mask;
+        }
+
+        // Bulunamazsa npos; empty_key için m_keys.size()
+        std::size_t locate(SerialDate::rep key) const noexcept {
+            if (key == empty_key) {
+                return m_has_empty_key ? m_keys.size() : npos;
+            }
+            if (m_size == 0) {
+                return npos;
+            }
+            std::size_t slot = home(key);
+            while (m_keys[slot] != empty_key) {
+                if (m_keys[slot] == key) {
+                    return slot;
+                }
+                slot = (slot + 1) & m_mask;
+            }
+            return npos;
+        }
+
+        void rehash(std::size_t slots) {
+            std::vector<SerialDate::rep> keys(slots, empty_key);
+            std::vector<T> values(slots + 1);
+            keys.swap(m_keys);
+            values.swap(m_values);
+            m_mask = slots - 1;
+            if (!values.empty()) {
+                m_values[slots] = std::move(values[keys.size()]);
+            }
+            for (std::size_t i = 0; i < keys.size(); ++i) {
+                if (keys[i] != empty_key) {
+                    std::size_t slot = home(keys[i]);
+                    while (m_keys[slot] != empty_key) {
+                        slot = (slot + 1) & m_mask;
+                    }
+                    m_keys[slot] = keys[i];
+                    m_values[slot] = std::move(values[i]);
+                }
+            }
+        }
+
+        std::vector<SerialDate::rep> m_keys;
+        std::vector<T> m_values;
+        std::size_t m_mask = 0;
+        std::size_t m_size = 0;
+        bool m_has_empty_key = false;
+    };
+}
+
+#endif
@@ -0,0 +1,123 @@
+#include "date_time.h"
+#include <chrono>
+#include <ostream>
+
+namespace project {
+
+    // Helper functions
+    namespace {
+        char* write_2digits(char* p, int value) noexcept {
+            p[0] = static_cast<char>('0' + value / 10);
+            p[1] = static_cast<char>('0' + value % 10);
+            return p + 2;
+        }
+
+        const char* read_2digits(const char* p, const char* last, int& value) noexcept {
+            if (last - p < 2 || static_cast<unsigned>(p[0] - '0') > 9 || static_cast<unsigned>(p[1] - '0') > 9) {
+                return nullptr;
+            }
+            value = (p[0] - '0') * 10 + (p[1] - '0');
+            return p + 2;
+        }
+    }
+
+    DateTime DateTime::now() noexcept {
+        const auto since_epoch = std::chrono::system_clock::now().time_since_epoch();
+        return from_nanos(std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch).count());
+    }
+
+    std::to_chars_result to_chars(char* first, char* last, DateTime value, DateFormat fmt) noexcept {
+        std::to_chars_result r = to_chars(first, last, value.serial_date(), fmt);
+        if (r.ec != std::errc{}) {
+            return r;
+        }
+        const int nanos = value.nanosecond();
+        const std::size_t need = nanos != 0 ? 19 : 9;
+        if (static_cast<std::size_t>(last - r.ptr) < need) {
+            return { last, std::errc::value_too_large };
+        }
+
+        char* p = r.ptr;
+        *p++ = fmt == DateFormat::iso ? 'T' : ' ';
+        p = write_2digits(p, value.hour());
+        *p++ = ':';
+        p = write_2digits(p, value.minute());
+        *p++ = ':';
+        p = write_2digits(p, value.second());
+        if (nanos != 0) {
+            *p++ = '.';
+            int n = nanos;
+            for (int i = 8; i >= 0; --i) {
+                p[i] = static_cast<char>('0' + n % 10);
+                n /= 10;
+            }
+            p += 9;
+        }
+        return { p, std::errc{} };
+    }
+
+    DateParseResult parse_date_time(std::string_view text, DateTime& value) noexcept {
+        const char* const last = text.data() + text.size();
+        int day, month, year;
+        DateParseResult r = scan_date(text, day, month, year);
+        if (r.ec != DateErrc::ok) {
+            return r;
+        }
+        const DateErrc date_ec = Date::check_date(day, month, year);
+        if (date_ec != DateErrc::ok) {
+            return { r.ptr, date_ec };
+        }
+
+        int hour = 0, minute = 0, second = 0, nanos = 0;
+        const char* p = r.ptr;
+        if (p != last && (*p == ' ' || *p == 'T')) {
+            const char* q = read_2digits(p + 1, last, hour);
+            if (q && q != last && *q == ':') {
+                q = read_2digits(q + 1, last, minute);
+            } else {
+                q = nullptr;
+            }
+            if (!q) {
+                return { p, DateErrc::invalid_format };
+            }
+            p = q;
+            if (p != last && *p == ':') {
+                if (!(p = read_2digits(p + 1, last, second))) {
+                    return { q, DateErrc::invalid_format };
+                }
+                if (p != last && *p == '.') {
+                    const char* const digits = ++p;
+                    int scale = 100'000'000;
+                    while (p != last && static_cast<unsigned>(*p - '0') <= 9 && scale != 0) {
+                        nanos += (*p - '0') * scale;
+                        scale /= 10;
+                        ++p;
+                    }
+                    if (p == digits) {
+                        return { p, DateErrc::invalid_format };
+                    }
+                }
+            }
+            const DateErrc time_ec = DateTime::check_time(hour, minute, second, nanos);
+            if (time_ec != DateErrc::ok) {
+                return { p, time_ec };
+            }
+        }
+
+        const int serial = civil::days_from_civil(day, month, year);
+        const DateTime::rep time = hour * DateTime::nanos_per_hour + minute * DateTime::nanos_per_minute +
+                                   second * DateTime::nanos_per_second + nanos;
+        if (!DateTime::in_range(serial, time)) {
+            return { r.ptr, DateErrc::invalid_year };
+        }
+        value = DateTime::from_nanos(static_cast<DateTime::rep>(serial - unix_epoch_serial) * DateTime::nanos_per_day + time);
+        return { p, DateErrc::ok };
+    }
+
+    // Stream operators
+    std::ostream& operator<<(std::ostream& os, DateTime value) {
+        char buf[max_date_time_chars];
+        const std::to_chars_result r = to_chars(buf, buf + sizeof(buf), value);
+        return os.write(buf, r.ptr - buf);
+    }
+}
@@ -0,0 +1,169 @@
+#ifndef DATE_TIME_H
+#define DATE_TIME_H
+
+#include <cstdint>
+#include <ctime>
+#include <iosfwd>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include "date.h"
+#include "date_clock.h"
+#include "date_format.h"
+#include "date_parse.h"
+#include "serial_date.h"
+
+namespace project {
+    // Unix epoch'tan (01/01/1970 00:00 UTC) bu yana geçen nanosaniye olarak
+    // tek bir 64 bitlik tamsayıda tarih ve saat. Değer, gün seri numarası ve
+    // gün içi nanosaniyenin doğrusal paketidir: (seri - epoch) * gün + ns.
+    // Karşılaştırma ve sıralama tamsayı işlemidir. Gösterilebilen aralık
+    // 21/09/1677 - 11/04/2262'dir (in_range); from_nanos, from_time_t ve
+    // now bu aralığın tamamını kapsar. Date üzerinden giden girişler
+    // (ayrıştırma, Date kurucuları) Date::check_date'ten geçtiğinden
+    // 01/01/1900 - 11/04/2262 aralığını kabul eder; ayrıştırma ve saatli
+    // kurucu aralığı denetler, diğer dönüşümler denetlemez.
+    // Saat dilimi tutulmaz; time_t dönüşümleri UTC'dir.
+    class DateTime {
+    public:
+        using rep = std::int64_t;
+
+        static constexpr rep nanos_per_second = 1'000'000'000;
+        static constexpr rep nanos_per_minute = 60 * nanos_per_second;
+        static constexpr rep nanos_per_hour = 60 * nanos_per_minute;
+        static constexpr rep nanos_per_day = 24 * nanos_per_hour;
+
+        // Constructors
+        constexpr DateTime() noexcept = default;
+        // Önkoşul: in_range(date.get_day_serial()); 11/04/2262'den sonraki
+        // tarihler taşar.
+        constexpr explicit DateTime(const Date& date) noexcept
+            : m_nanos(static_cast<rep>(date.get_day_serial() - unix_epoch_serial) * nanos_per_day) {}
+        // Geçersiz saat ya da aralık dışı tarih için DateException fırlatır.
+        constexpr DateTime(const Date& date, int hour, int minute, int second = 0, int nanosecond = 0) {
+            DateErrc ec = check_time(hour, minute, second, nanosecond);
+            const rep time = hour * nanos_per_hour + minute * nanos_per_minute + second * nanos_per_second + nanosecond;
+            if (ec == DateErrc::ok && !in_range(date.get_day_serial(), time)) {
+                ec = DateErrc::invalid_year;
+            }
+            if (ec != DateErrc::ok) {
+                throw_date_error(ec, date.get_month_day(), date.get_month(), date.get_year());
+            }
+            m_nanos = static_cast<rep>(date.get_day_serial() - unix_epoch_serial) * nanos_per_day + time;
+        }
+
+        [[nodiscard]] static constexpr DateTime from_nanos(rep nanos) noexcept {
+            DateTime t;
+            t.m_nanos = nanos;
+            return t;
+        }
+        [[nodiscard]] static constexpr DateTime from_time_t(std::time_t t) noexcept {
+            return from_nanos(static_cast<rep>(t) * nanos_per_second);
+        }
+        [[nodiscard]] static DateTime now() noexcept;
+
+        // serial günündeki time_of_day nanosaniyesi rep'e sığıyor mu
+        // (21/09/1677 00:12:43.145224192 - 11/04/2262 23:47:16.854775807)
+        [[nodiscard]] static constexpr bool in_range(int serial, rep time_of_day = 0) noexcept {
+            constexpr rep max = std::numeric_limits<rep>::max();
+            constexpr rep min = std::numeric_limits<rep>::min();
+            // min'in kalanı negatif olduğundan ilk gün bölümün bir öncesidir
+            constexpr rep first_day = min / nanos_per_day - 1;
+            constexpr rep first_time = min % nanos_per_day + nanos_per_day;
+            const rep days = static_cast<rep>(serial) - unix_epoch_serial;
+            if (days > first_day && days < max / nanos_per_day) {
+                return true;
+            }
+            if (days == max / nanos_per_day) {
+                return time_of_day <= max % nanos_per_day;
+            }
+            return days == first_day && time_of_day >= first_time;
+        }
+
+        [[nodiscard]] static constexpr DateErrc check_time(int hour, int minute, int second, int nanosecond) noexcept {
+            if (hour < 0 || hour > 23 || minute < 0 || minute > 59 || second < 0 || second > 59 ||
+                nanosecond < 0 || nanosecond >= nanos_per_second) {
+                return DateErrc::invalid_time;
+            }
+            return DateErrc::ok;
+        }
+
+        // Conversion
+        [[nodiscard]] constexpr rep nanos() const noexcept { return m_nanos; }
+        [[nodiscard]] constexpr std::time_t to_time_t() const noexcept {
+            return static_cast<std::time_t>(floor_div(m_nanos, nanos_per_second));
+        }
+        [[nodiscard]] constexpr SerialDate serial_date() const noexcept {
+            return SerialDate::from_serial(static_cast<SerialDate::rep>(floor_div(m_nanos, nanos_per_day) + unix_epoch_serial));
+        }
+        // Önkoşul: değer 01/01/1900 ya da sonrasıdır; öncesinde dönen Date
+        // denetlenmemiştir (get_year() < Date::year_base). Denetimli sürüm try_date.
+        [[nodiscard]] constexpr Date date() const noexcept { return serial_date().to_date(); }
+        // 01/01/1900'den önceki değerler için DateErrc::invalid_year
+        [[nodiscard]] constexpr DateResult try_date() const noexcept {
+            const SerialDate date = serial_date();
+            if (date.serial() < civil::days_from_civil(1, 1, Date::year_base)) {
+                return DateErrc::invalid_year;
+            }
+            return date.to_date();
+        }
+
+        // Getters
+        [[nodiscard]] constexpr rep time_of_day() const noexcept { return m_nanos - floor_div(m_nanos, nanos_per_day) * nanos_per_day; }
+        [[nodiscard]] constexpr int hour() const noexcept { return static_cast<int>(time_of_day() / nanos_per_hour); }
+        [[nodiscard]] constexpr int minute() const noexcept { return static_cast<int>(time_of_day() / nanos_per_minute % 60); }
+        [[nodiscard]] constexpr int second() const noexcept { return static_cast<int>(time_of_day() / nanos_per_second % 60); }
+        [[nodiscard]] constexpr int nanosecond() const noexcept { return static_cast<int>(time_of_day() % nanos_per_second); }
+
+        // Truncation: unit'in katına aşağı yuvarlar (epoch'tan önce de)
+        [[nodiscard]] constexpr DateTime floor(rep unit) const noexcept { return from_nanos(floor_div(m_nanos, unit) * unit); }
+        [[nodiscard]] constexpr DateTime floor_day() const noexcept { return floor(nanos_per_day); }
+        [[nodiscard]] constexpr DateTime floor_hour() const noexcept { return floor(nanos_per_hour); }
+        [[nodiscard]] constexpr DateTime floor_minute() const noexcept { return floor(nanos_per_minute); }
+        [[nodiscard]] constexpr DateTime floor_second() const noexcept { return floor(nanos_per_second); }
+
+        // Arithmetic operators (nanosaniye)
+        constexpr DateTime& operator+=(rep nanos) noexcept { m_nanos += nanos; return *this; }
+        constexpr DateTime& operator-=(rep nanos) noexcept { m_nanos -= nanos; return *this; }
+
+        [[nodiscard]] friend constexpr DateTime operator+(DateTime t, rep nanos) noexcept { return t += nanos; }
+        [[nodiscard]] friend constexpr DateTime operator-(DateTime t, rep nanos) noexcept { return t -= nanos; }
+        [[nodiscard]] friend constexpr rep operator-(DateTime t1, DateTime t2) noexcept { return t1.m_nanos - t2.m_nanos; }
+
+        // Comparison operators
+        [[nodiscard]] friend constexpr bool operator<(DateTime t1, DateTime t2) noexcept { return t1.m_nanos < t2.m_nanos; }
+        [[nodiscard]] friend constexpr bool operator<=(DateTime t1, DateTime t2) noexcept { return t1.m_nanos <= t2.m_nanos; }
+        [[nodiscard]] friend constexpr bool operator>(DateTime t1, DateTime t2) noexcept { return t1.m_nanos > t2.m_nanos; }
+        [[nodiscard]] friend constexpr bool operator>=(DateTime t1, DateTime t2) noexcept { return t1.m_nanos >= t2.m_nanos; }
+        [[nodiscard]] friend constexpr bool operator==(DateTime t1, DateTime t2) noexcept { return t1.m_nanos == t2.m_nanos; }
+        [[nodiscard]] friend constexpr bool operator!=(DateTime t1, DateTime t2) noexcept { return t1.m_nanos != t2.m_nanos; }
+
+    private:
+        static constexpr rep floor_div(rep a, rep b) noexcept {
+            return (a >= 0 ? a : a - (b - 1)) / b;
+        }
+
+        rep m_nanos = 0;
+    };
+
+    static_assert(sizeof(DateTime) == sizeof(std::int64_t));
+    static_assert(std::is_trivially_copyable_v<DateTime>);
+    static_assert(DateTime(Date(1, 1, 1970)).nanos() == 0);
+
+    // Tarih biçimi DateFormat'a göre, ardından " ss:dd:ss" (iso: "T"),
+    // kesir sıfır değilse ".nnnnnnnnn". Bellek ayırmaz, istisna fırlatmaz.
+    inline constexpr std::size_t max_date_time_chars = max_date_chars + 19;
+
+    std::to_chars_result to_chars(char* first, char* last, DateTime value,
+                                  DateFormat fmt = DateFormat::turkish_long) noexcept;
+
+    // "gg/aa/yyyy[ ss:dd[:ss[.kesir]]]"; tarih ile saat arasında boşluk ya
+    // da 'T' olabilir, kesir en fazla 9 hanedir. Saat yoksa gece yarısı.
+    // Hata durumunda value değiştirilmez.
+    [[nodiscard]] DateParseResult parse_date_time(std::string_view text, DateTime& value) noexcept;
+
+    // Stream operators
+    std::ostream& operator<<(std::ostream& os, DateTime value);
+}
+
+#endif
@@ -1,7 +1,12 @@
+#include "batch_mode.h"
 #include "date.h"
+#include "date_clock.h"
+#include "date_period.h"
+#include "service_mode.h"
 #include <iostream>
 #include <iomanip>
 #include <limits>
+#include <string_view>
 
 using namespace project;
 
@@ -23,49 +28,11 @@ void printHeader(const std::string& title) {
 void calculateAge(const Date& birthDate, const Date& today) {
     int totalDays = today - birthDate;
     
-    int years = 0;
-    int months = 0;
-    int days = 0;
-    
-    // Yıl hesaplama
-    Date temp = birthDate;
-    while (temp.get_year() < today.get_year() || 
-           (temp.get_year() == today.get_year() && temp.get_month() < today.get_month()) ||
-           (temp.get_year() == today.get_year() && temp.get_month() == today.get_month() && 
-            temp.get_month_day() <= today.get_month_day())) {
-        
-        Date nextYear(temp.get_month_day(), temp.get_month(), temp.get_year() + 1);
-        if (nextYear <= today) {
-            years++;
-            temp = nextYear;
-        } else {
-            break;
-        }
-    }
-    
-    // Ay hesaplama
-    while (temp.get_month() < today.get_month() || 
-           (temp.get_month() == today.get_month() && temp.get_month_day() <= today.get_month_day())) {
-        
-        int nextMonth = temp.get_month() + 1;
-        int nextYear = temp.get_year();
-        
-        if (nextMonth > 12) {
-            nextMonth = 1;
-            nextYear++;
-        }
-        
-        Date nextMonthDate(temp.get_month_day(), nextMonth, nextYear);
-        if (nextMonthDate <= today) {
-            months++;
-            temp = nextMonthDate;
-        } else {
-            break;
-        }
-    }
-    
-    // Gün hesaplama
-    days = today - temp;
+    // Yıl, ay ve gün farkı (ay sonuna kırpmalı)
+    const Period age = period_between(birthDate, today);
+    const int years = age.years;
+    const int months = age.months;
+    const int days = age.days;
     
     std::cout << "\n";
     printHeader("YAS HESAPLAMA SONUCU");
@@ -136,7 +103,7 @@ void option1_calculateBirthAge() {
     
     try {
         Date birthDate = getDateFromUser("Dogum tarihinizi giriniz:");
-        Date today(std::time(nullptr));
+        Date today = project::today();
         
         if (birthDate > today) {
             std::cout << "\n  HATA: Dogum tarihi gelecekte olamaz!\n";
@@ -165,11 +132,10 @@ void option1_calculateBirthAge() {
         
         std::cout << "  - Yilin " << birthDate.get_year_day() << ". gununde dogdunuz.\n";
         
-        // Bir sonraki doğum günü
-        Date nextBirthday(birthDate.get_month_day(), birthDate.get_month(), today.get_year());
-        if (nextBirthday < today) {
-            nextBirthday.set_year(today.get_year() + 1);
-        }
+        // Bir sonraki doğum günü (29 Şubat doğumlular için artık olmayan yıllarda 28 Şubat)
+        const Period age = period_between(birthDate, today);
+        const bool birthdayToday = age.months == 0 && age.days == 0;
+        const Date nextBirthday = add_years(birthDate, birthdayToday ? age.years : age.years + 1);
         
         int daysUntilBirthday = nextBirthday - today;
         std::cout << "  - Bir sonraki dogum gununuze " << daysUntilBirthday << " gun kaldi!\n";
@@ -300,7 +266,7 @@ void option5_randomDates() {
 void option6_showToday() {
     printHeader("BUGUNUN TARIHI");
     
-    Date today(std::time(nullptr));
+    Date today = project::today();
     
     std::cout << "\n  Tarih        : " << today << "\n";
     std::cout << "  Yilin gunu   : " << today.get_year_day() << ". gun\n";
@@ -315,7 +281,19 @@ void option6_showToday() {
     printSeparator();
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+    // Toplu mod: komutlar stdin'den ya da dosyalardan okunur
+    if (argc > 1 && std::string_view(argv[1]) == "--batch") {
+        return run_batch_main(argc - 2, argv + 2);
+    }
+    // Servis modu: Unix soketi üzerinden ikili protokol; --load yük üretir
+    if (argc > 1 && std::string_view(argv[1]) == "--serve") {
+        return run_service_main(argc - 2, argv + 2);
+    }
+    if (argc > 1 && std::string_view(argv[1]) == "--load") {
+        return run_load_main(argc - 2, argv + 2);
+    }
+
     std::cout << "\n";
     printHeader("DATE SINIFI - TARIH ISLEMLERI PROGRAMI");
     std::cout << "\n  Hosgeldiniz! Bu program tarih hesaplamalari yapmaniza yardimci olur.\n";
@@ -0,0 +1,17 @@
+#include "serial_date.h"
+#include <iostream>
+
+namespace project {
+
+    // Stream operators
+    std::ostream& operator<<(std::ostream& os, SerialDate date) {
+        return os << date.to_date();
+    }
+
+    std::istream& operator>>(std::istream& is, SerialDate& date) {
+        Date temp;
+        is >> temp;
+        date = SerialDate{ temp };
+        return is;
+    }
+}
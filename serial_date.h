@@ -0,0 +1,87 @@
+#ifndef SERIAL_DATE_H
+#define SERIAL_DATE_H
+
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include "date.h"
+
+namespace project {
+    // Tarihi tek bir 32 bitlik gün seri numarası (Rata Die) olarak tutar.
+    // Fark, gün ekleme ve sıralama tek tamsayı işlemidir; gün/ay/yıl
+    // alanları yalnızca istendiğinde çözülür.
+    class SerialDate {
+    public:
+        using rep = std::int32_t;
+
+        // Constructors
+        constexpr SerialDate() noexcept
+            : m_serial(civil::days_from_civil(1, 1, Date::year_base)) {}
+        constexpr SerialDate(int d, int m, int y) : SerialDate(Date{ d, m, y }) {}
+        constexpr explicit SerialDate(const Date& date) noexcept : m_serial(date.get_day_serial()) {}
+
+        [[nodiscard]] static constexpr SerialDate from_serial(rep serial) noexcept {
+            SerialDate date;
+            date.m_serial = serial;
+            return date;
+        }
+
+        // Conversion
+        [[nodiscard]] constexpr rep serial() const noexcept { return m_serial; }
+        [[nodiscard]] constexpr Date to_date() const noexcept { return Date::from_day_serial(m_serial); }
+        constexpr explicit operator Date() const noexcept { return to_date(); }
+
+        // Getters
+        [[nodiscard]] constexpr int get_month_day() const noexcept { return civil::civil_from_days(m_serial).day; }
+        [[nodiscard]] constexpr int get_month() const noexcept { return civil::civil_from_days(m_serial).month; }
+        [[nodiscard]] constexpr int get_year() const noexcept { return civil::civil_from_days(m_serial).year; }
+        [[nodiscard]] constexpr int get_year_day() const noexcept {
+            const civil::CivilDate c = civil::civil_from_days(m_serial);
+            return civil::year_day(c.day, c.month, c.year);
+        }
+        [[nodiscard]] constexpr Date::Weekday get_week_day() const noexcept {
+            // 01/01/0001 Pazartesi'dir; seri % 7 doğrudan Weekday değerini verir.
+            return static_cast<Date::Weekday>((m_serial % 7 + 7) % 7);
+        }
+
+        // Arithmetic operators
+        constexpr SerialDate& operator+=(int day) noexcept { m_serial += day; return *this; }
+        constexpr SerialDate& operator-=(int day) noexcept { m_serial -= day; return *this; }
+        constexpr SerialDate& operator++() noexcept { ++m_serial; return *this; }
+        constexpr SerialDate operator++(int) noexcept { SerialDate temp{ *this }; ++m_serial; return temp; }
+        constexpr SerialDate& operator--() noexcept { --m_serial; return *this; }
+        constexpr SerialDate operator--(int) noexcept { SerialDate temp{ *this }; --m_serial; return temp; }
+
+        [[nodiscard]] friend constexpr SerialDate operator+(SerialDate date, int n) noexcept { return date += n; }
+        [[nodiscard]] friend constexpr SerialDate operator+(int n, SerialDate date) noexcept { return date += n; }
+        [[nodiscard]] friend constexpr SerialDate operator-(SerialDate date, int n) noexcept { return date -= n; }
+        [[nodiscard]] friend constexpr int operator-(SerialDate d1, SerialDate d2) noexcept { return d1.m_serial - d2.m_serial; }
+
+        // Comparison operators
+        [[nodiscard]] friend constexpr bool operator<(SerialDate d1, SerialDate d2) noexcept { return d1.m_serial < d2.m_serial; }
+        [[nodiscard]] friend constexpr bool operator<=(SerialDate d1, SerialDate d2) noexcept { return d1.m_serial <= d2.m_serial; }
+        [[nodiscard]] friend constexpr bool operator>(SerialDate d1, SerialDate d2) noexcept { return d1.m_serial > d2.m_serial; }
+        [[nodiscard]] friend constexpr bool operator>=(SerialDate d1, SerialDate d2) noexcept { return d1.m_serial >= d2.m_serial; }
+        [[nodiscard]] friend constexpr bool operator==(SerialDate d1, SerialDate d2) noexcept { return d1.m_serial == d2.m_serial; }
+        [[nodiscard]] friend constexpr bool operator!=(SerialDate d1, SerialDate d2) noexcept { return d1.m_serial != d2.m_serial; }
+
+    private:
+        rep m_serial;
+    };
+
+    static_assert(sizeof(SerialDate) == sizeof(std::int32_t));
+
+    // Stream operators
+    std::ostream& operator<<(std::ostream& os, SerialDate date);
+    std::istream& operator>>(std::istream& is, SerialDate& date);
+}
+
+// std::hash<Date> ile aynı değeri verir.
+template <>
+struct std::hash<project::SerialDate> {
+    [[nodiscard]] std::size_t operator()(project::SerialDate date) const noexcept {
+        return std::hash<int>{}(date.serial());
+    }
+};
+
+#endif
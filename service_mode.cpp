@@ -0,0 +1,732 @@
+#include "service_mode.h"
+#include "date_batch.h"
+#include "date_clock.h"
+#include "date_parallel.h"
+#include "date_period.h"
+#include "date_random.h"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#define PROJECT_DATE_HAS_EPOLL 1
+#include <cerrno>
+#include <csignal>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#else
+#define PROJECT_DATE_HAS_EPOLL 0
+#endif
+
+namespace project {
+
+    // Helper functions
+    namespace {
+        using service::Op;
+        using service::Request;
+        using service::Response;
+        using service::Status;
+
+        // Bu kadar günden büyük eklemeler geçersiz yıl sayılır (taşma olmasın)
+        constexpr std::int32_t max_add_days = 10'000'000;
+        // yyyymmdd olarak int32'ye sığan en büyük yıl (214748/12/31)
+        constexpr int max_packed_year = (std::numeric_limits<std::int32_t>::max() - 1231) / 10000;
+
+        Status to_status(DateErrc ec) noexcept {
+            switch (ec) {
+                case DateErrc::ok:            return Status::ok;
+                case DateErrc::invalid_month: return Status::invalid_month;
+                case DateErrc::invalid_day:   return Status::invalid_day;
+                default:                      return Status::invalid_year;
+            }
+        }
+
+        Status check_packed(std::int32_t packed) noexcept {
+            if (packed < 0) {
+                return Status::invalid_year;
+            }
+            return to_status(Date::check_date(packed % 100, packed / 100 % 100, packed / 10000));
+        }
+
+        // İstekler işlem türüne göre gruplanır; her grup gün/ay/yıl
+        // sütunlarına açılıp batch çekirdekleriyle hesaplanır. Ara bellekler
+        // turlar arasında yeniden kullanılır.
+        class Processor {
+        public:
+            void run(const Request* requests, Response* responses, std::size_t count) {
+                for (std::vector<std::uint32_t>& group : m_groups) {
+                    group.clear();
+                }
+                const std::int32_t today_packed = service::pack_date(today());
+
+                for (std::size_t i = 0; i < count; ++i) {
+                    const Request& r = requests[i];
+                    Response& out = responses[i];
+                    out = Response{};
+                    out.id = r.id;
+                    out.op = r.op;
+                    const int op = static_cast<int>(r.op);
+                    if (op < static_cast<int>(Op::age) || op > static_cast<int>(Op::leap_check)) {
+                        out.status = Status::invalid_op;
+                        continue;
+                    }
+                    Status status = Status::ok;
+                    switch (r.op) {
+                        case Op::age:
+                            status = check_packed(r.a);
+                            if (status == Status::ok && r.b != 0) {
+                                status = check_packed(r.b);
+                            }
+                            break;
+                        case Op::diff:
+                            status = check_packed(r.a);
+                            if (status == Status::ok) {
+                                status = check_packed(r.b);
+                            }
+                            break;
+                        case Op::add_days:
+                            status = check_packed(r.a);
+                            if (status == Status::ok && (r.b > max_add_days || r.b < -max_add_days)) {
+                                status = Status::invalid_year;
+                            }
+                            break;
+                        case Op::weekday:
+                            status = check_packed(r.a);
+                            break;
+                        case Op::leap_check:
+                            break;
+                    }
+                    out.status = status;
+                    if (status == Status::ok) {
+                        m_groups[op].push_back(static_cast<std::uint32_t>(i));
+                    }
+                }
+
+                run_age(requests, responses, today_packed);
+                run_diff(requests, responses);
+                run_add_days(requests, responses);
+                run_weekday(requests, responses);
+                run_leap_check(requests, responses);
+            }
+
+        private:
+            const std::vector<std::uint32_t>& group(Op op) const noexcept {
+                return m_groups[static_cast<int>(op)];
+            }
+
+            // Gruptaki her isteğin a (second: b) tarihinin seri numarası m_serials[slot]'a
+            void to_serials(const Request* requests, const std::vector<std::uint32_t>& group, bool second,
+                            std::int32_t fallback, int slot) {
+                const std::size_t n = group.size();
+                m_days.resize(n);
+                m_months.resize(n);
+                m_years.resize(n);
+                m_serials[slot].resize(n);
+                for (std::size_t j = 0; j < n; ++j) {
+                    const Request& r = requests[group[j]];
+                    std::int32_t packed = second ? r.b : r.a;
+                    if (packed == 0) {
+                        packed = fallback;
+                    }
+                    m_days[j] = packed % 100;
+                    m_months[j] = packed / 100 % 100;
+                    m_years[j] = packed / 10000;
+                }
+                batch::to_serials(m_days.data(), m_months.data(), m_years.data(), m_serials[slot].data(), n);
+            }
+
+            void run_age(const Request* requests, Response* responses, std::int32_t today_packed) {
+                const std::vector<std::uint32_t>& g = group(Op::age);
+                to_serials(requests, g, false, 0, 0);
+                to_serials(requests, g, true, today_packed, 1);
+                // Yıl/ay/gün farkı için vektörel çekirdek yok; seri numaraları
+                // hazır olduğundan period_between sabit zamanlıdır.
+                for (std::size_t j = 0; j < g.size(); ++j) {
+                    Response& out = responses[g[j]];
+                    const SerialDate birth = SerialDate::from_serial(m_serials[0][j]);
+                    const SerialDate ref = SerialDate::from_serial(m_serials[1][j]);
+                    if (ref < birth) {
+                        out.status = Status::birth_in_future;
+                        continue;
+                    }
+                    const Period age = period_between(birth, ref);
+                    out.value[0] = age.years;
+                    out.value[1] = age.months;
+                    out.value[2] = age.days;
+                }
+            }
+
+            void run_diff(const Request* requests, Response* responses) {
+                const std::vector<std::uint32_t>& g = group(Op::diff);
+                to_serials(requests, g, false, 0, 0);
+                to_serials(requests, g, true, 0, 1);
+                m_values.resize(g.size());
+                batch::diff_days(m_serials[1].data(), m_serials[0].data(), m_values.data(), g.size());
+                for (std::size_t j = 0; j < g.size(); ++j) {
+                    responses[g[j]].value[0] = m_values[j];
+                }
+            }
+
+            void run_add_days(const Request* requests, Response* responses) {
+                const std::vector<std::uint32_t>& g = group(Op::add_days);
+                to_serials(requests, g, false, 0, 0);
+                m_values.resize(g.size());
+                for (std::size_t j = 0; j < g.size(); ++j) {
+                    m_values[j] = requests[g[j]].b;
+                }
+                m_serials[1].resize(g.size());
+                batch::add_days(m_serials[0].data(), m_values.data(), m_serials[1].data(), g.size());
+                batch::from_serials(m_serials[1].data(), m_days.data(), m_months.data(), m_years.data(), g.size());
+                for (std::size_t j = 0; j < g.size(); ++j) {
+                    Response& out = responses[g[j]];
+                    if (m_years[j] < Date::year_base || m_years[j] > max_packed_year) {
+                        out.status = Status::invalid_year;
+                        continue;
+                    }
+                    out.value[0] = m_years[j] * 10000 + m_months[j] * 100 + m_days[j];
+                }
+            }
+
+            void run_weekday(const Request* requests, Response* responses) {
+                const std::vector<std::uint32_t>& g = group(Op::weekday);
+                to_serials(requests, g, false, 0, 0);
+                m_flags.resize(g.size());
+                batch::week_days(m_serials[0].data(), m_flags.data(), g.size());
+                for (std::size_t j = 0; j < g.size(); ++j) {
+                    responses[g[j]].value[0] = m_flags[j];
+                }
+            }
+
+            void run_leap_check(const Request* requests, Response* responses) {
+                const std::vector<std::uint32_t>& g = group(Op::leap_check);
+                m_years.resize(g.size());
+                m_flags.resize(g.size());
+                for (std::size_t j = 0; j < g.size(); ++j) {
+                    m_years[j] = requests[g[j]].a;
+                }
+                batch::leap_flags_from_years(m_years.data(), m_flags.data(), g.size());
+                for (std::size_t j = 0; j < g.size(); ++j) {
+                    responses[g[j]].value[0] = m_flags[j];
+                }
+            }
+
+            std::vector<std::uint32_t> m_groups[static_cast<int>(Op::leap_check) + 1];
+            std::vector<std::int32_t> m_days;
+            std::vector<std::int32_t> m_months;
+            std::vector<std::int32_t> m_years;
+            std::vector<std::int32_t> m_serials[2];
+            std::vector<std::int32_t> m_values;
+            std::vector<std::uint8_t> m_flags;
+        };
+
+        template<typename T>
+        bool parse_number(std::string_view token, T& value) noexcept {
+            const char* last = token.data() + token.size();
+            const std::from_chars_result r = std::from_chars(token.data(), last, value);
+            return r.ec == std::errc{} && r.ptr == last;
+        }
+
+#if PROJECT_DATE_HAS_EPOLL
+        [[noreturn]] void fail_system(const std::string& what) {
+            throw std::runtime_error(what + ": " + std::strerror(errno));
+        }
+
+        class Descriptor {
+        public:
+            explicit Descriptor(int fd) noexcept : m_fd(fd) {}
+            ~Descriptor() {
+                if (m_fd >= 0) {
+                    ::close(m_fd);
+                }
+            }
+            Descriptor(const Descriptor&) = delete;
+            Descriptor& operator=(const Descriptor&) = delete;
+
+            [[nodiscard]] int get() const noexcept { return m_fd; }
+
+        private:
+            int m_fd;
+        };
+
+        struct Connection {
+            explicit Connection(int descriptor) noexcept : fd(descriptor) {}
+
+            Descriptor fd;
+            std::vector<unsigned char> in;    // yarım kalan istek baytları
+            std::vector<unsigned char> out;   // gönderilmeyi bekleyen yanıtlar
+            std::size_t sent = 0;
+            std::uint32_t events = EPOLLIN;   // epoll'a kayıtlı olaylar
+            bool closed = false;
+        };
+
+        // Bir turda bir bağlantıdan okunan en fazla bayt
+        constexpr std::size_t max_read_bytes = 256 << 10;
+        // Gönderilmeyi bekleyen yanıtlar bunu aşınca bağlantıdan okuma
+        // durdurulur (yanıtlarını okumayan istemci belleği büyütemez);
+        // yarısının altına inince yeniden başlar.
+        constexpr std::size_t max_pending_bytes = 1 << 20;
+
+        sockaddr_un socket_address(const std::string& path) {
+            sockaddr_un addr{};
+            addr.sun_family = AF_UNIX;
+            if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+                throw std::runtime_error("Gecersiz soket yolu: " + path);
+            }
+            std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+            return addr;
+        }
+
+        // En fazla max_read_bytes okur; kalan sonraki turda (epoll yeniden
+        // bildirir). Karşı taraf kapattıysa closed
+        void receive(Connection& c) {
+            unsigned char buf[64 << 10];
+            for (std::size_t total = 0; total < max_read_bytes;) {
+                const ssize_t n = ::recv(c.fd.get(), buf, std::min(sizeof(buf), max_read_bytes - total), 0);
+                if (n > 0) {
+                    c.in.insert(c.in.end(), buf, buf + n);
+                    total += static_cast<std::size_t>(n);
+                } else if (n < 0 && errno == EINTR) {
+                    continue;
+                } else {
+                    if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+                        c.closed = true;
+                    }
+                    return;
+                }
+            }
+        }
+
+        // Gönderilebilen kadarını yazar; kalan varsa EPOLLOUT ile beklenir
+        void flush(int epoll_fd, Connection& c) {
+            while (c.sent < c.out.size()) {
+                const ssize_t n = ::send(c.fd.get(), c.out.data() + c.sent, c.out.size() - c.sent, MSG_NOSIGNAL);
+                if (n < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                        c.closed = true;
+                        return;
+                    }
+                    break;
+                }
+                c.sent += static_cast<std::size_t>(n);
+            }
+            if (c.sent == c.out.size()) {
+                c.out.clear();
+                c.sent = 0;
+            } else if (c.sent >= c.out.size() / 2) {
+                // Gönderilmiş önek atılır; yavaş istemcide tampon birikmesin
+                c.out.erase(c.out.begin(), c.out.begin() + static_cast<std::ptrdiff_t>(c.sent));
+                c.sent = 0;
+            }
+
+            const std::size_t pending = c.out.size() - c.sent;
+            bool reading = (c.events & EPOLLIN) != 0;
+            if (pending > max_pending_bytes) {
+                reading = false;
+            } else if (pending <= max_pending_bytes / 2) {
+                reading = true;
+            }
+            const std::uint32_t events = (reading ? EPOLLIN : 0u) | (pending != 0 ? EPOLLOUT : 0u);
+            if (events != c.events) {
+                epoll_event ev{};
+                ev.events = events;
+                ev.data.ptr = &c;
+                ::epoll_ctl(epoll_fd, EPOLL_CTL_MOD, c.fd.get(), &ev);
+                c.events = events;
+            }
+        }
+
+        std::atomic<bool> stop_requested{ false };
+
+        void on_signal(int) {
+            stop_requested.store(true);
+        }
+#endif
+    }
+
+    // Service
+    ServiceStats run_service(const std::string& path, const ServiceOptions& options,
+                             const std::atomic<bool>& stop) {
+#if PROJECT_DATE_HAS_EPOLL
+        const sockaddr_un addr = socket_address(path);
+        const Descriptor listener(::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0));
+        if (listener.get() < 0) {
+            fail_system("Soket olusturulamadi");
+        }
+        // Yalnızca önceki çalışmadan kalan soket dosyası silinir; yol başka
+        // bir dosyaysa üzerine yazılmaz
+        struct stat existing {};
+        if (::lstat(path.c_str(), &existing) == 0) {
+            if (!S_ISSOCK(existing.st_mode)) {
+                throw std::runtime_error("Yol soket degil, silinmedi: " + path);
+            }
+            ::unlink(path.c_str());
+        }
+        if (::bind(listener.get(), reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            ::listen(listener.get(), SOMAXCONN) != 0) {
+            fail_system("Soket dinlenemedi: " + path);
+        }
+        const Descriptor epoll(::epoll_create1(EPOLL_CLOEXEC));
+        if (epoll.get() < 0) {
+            fail_system("epoll olusturulamadi");
+        }
+        epoll_event listen_event{};
+        listen_event.events = EPOLLIN;
+        listen_event.data.ptr = nullptr;   // dinleyen soket
+        if (::epoll_ctl(epoll.get(), EPOLL_CTL_ADD, listener.get(), &listen_event) != 0) {
+            fail_system("epoll_ctl");
+        }
+
+        ServiceStats stats;
+        std::unordered_map<int, std::unique_ptr<Connection>> connections;
+        std::vector<epoll_event> events(static_cast<std::size_t>(std::max(options.max_events, 1)));
+        const std::size_t max_batch = std::max<std::size_t>(options.max_batch, 1);
+        std::vector<Request> requests;
+        std::vector<Response> responses;
+        std::vector<Connection*> owners;    // requests[i]'nin bağlantısı
+        std::vector<Connection*> touched;
+        Processor processor;
+
+        while (!stop.load(std::memory_order_relaxed)) {
+            // Zaman aşımı durdurma isteğinin fark edilmesi içindir
+            const int ready = ::epoll_wait(epoll.get(), events.data(), static_cast<int>(events.size()), 100);
+            if (ready < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                fail_system("epoll_wait");
+            }
+
+            // Bu turda hazır olan tüm bağlantıların istekleri tek toplu işe
+            requests.clear();
+            owners.clear();
+            touched.clear();
+            for (int e = 0; e < ready; ++e) {
+                if (events[e].data.ptr == nullptr) {
+                    for (;;) {
+                        const int fd = ::accept4(listener.get(), nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                        if (fd < 0) {
+                            if (errno == EINTR || errno == ECONNABORTED) {
+                                continue;
+                            }
+                            break;   // EAGAIN ya da tanıtıcı sınırı: sonraki turda yeniden denenir
+                        }
+                        auto connection = std::make_unique<Connection>(fd);
+                        epoll_event ev{};
+                        ev.events = EPOLLIN;
+                        ev.data.ptr = connection.get();
+                        if (::epoll_ctl(epoll.get(), EPOLL_CTL_ADD, fd, &ev) != 0) {
+                            continue;
+                        }
+                        connections.emplace(fd, std::move(connection));
+                        ++stats.connections;
+                    }
+                    continue;
+                }
+
+                Connection& c = *static_cast<Connection*>(events[e].data.ptr);
+                if (events[e].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                    receive(c);
+                    const std::size_t whole = c.in.size() / service::request_bytes;
+                    for (std::size_t k = 0; k < whole; ++k) {
+                        Request r;
+                        service::decode(c.in.data() + k * service::request_bytes, r);
+                        requests.push_back(r);
+                        owners.push_back(&c);
+                    }
+                    c.in.erase(c.in.begin(), c.in.begin() + static_cast<std::ptrdiff_t>(whole * service::request_bytes));
+                }
+                touched.push_back(&c);
+            }
+
+            responses.resize(requests.size());
+            for (std::size_t i = 0; i < requests.size(); i += max_batch) {
+                processor.run(requests.data() + i, responses.data() + i, std::min(max_batch, requests.size() - i));
+                ++stats.batches;
+            }
+            stats.requests += requests.size();
+            for (std::size_t i = 0; i < responses.size(); ++i) {
+                unsigned char buf[service::response_bytes];
+                service::encode(responses[i], buf);
+                owners[i]->out.insert(owners[i]->out.end(), buf, buf + sizeof(buf));
+            }
+
+            for (Connection* c : touched) {
+                flush(epoll.get(), *c);
+                if (c->closed) {
+                    connections.erase(c->fd.get());
+                }
+            }
+        }
+        ::unlink(path.c_str());
+        return stats;
+#else
+        (void)path;
+        (void)options;
+        (void)stop;
+        throw std::runtime_error("Servis modu bu platformda desteklenmiyor");
+#endif
+    }
+
+    // Client
+    DateClient::DateClient(const std::string& path) {
+#if PROJECT_DATE_HAS_EPOLL
+        const sockaddr_un addr = socket_address(path);
+        m_fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (m_fd < 0) {
+            fail_system("Soket olusturulamadi");
+        }
+        if (::connect(m_fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+            const int error = errno;
+            ::close(m_fd);
+            m_fd = -1;
+            errno = error;
+            fail_system("Baglanilamadi: " + path);
+        }
+#else
+        (void)path;
+        throw std::runtime_error("Servis modu bu platformda desteklenmiyor");
+#endif
+    }
+
+    DateClient::~DateClient() {
+#if PROJECT_DATE_HAS_EPOLL
+        if (m_fd >= 0) {
+            ::close(m_fd);
+        }
+#endif
+    }
+
+    DateClient::DateClient(DateClient&& other) noexcept
+        : m_fd(other.m_fd), m_buffer(std::move(other.m_buffer)) {
+        other.m_fd = -1;
+    }
+
+    DateClient& DateClient::operator=(DateClient&& other) noexcept {
+        if (this != &other) {
+            std::swap(m_fd, other.m_fd);
+            std::swap(m_buffer, other.m_buffer);
+        }
+        return *this;
+    }
+
+    void DateClient::call(const service::Request* requests, service::Response* responses, std::size_t count) {
+#if PROJECT_DATE_HAS_EPOLL
+        const std::size_t send_bytes = count * service::request_bytes;
+        const std::size_t receive_bytes = count * service::response_bytes;
+        m_buffer.resize(send_bytes + receive_bytes);
+        for (std::size_t i = 0; i < count; ++i) {
+            service::encode(requests[i], m_buffer.data() + i * service::request_bytes);
+        }
+        unsigned char* const received = m_buffer.data() + send_bytes;
+
+        // Gönderme ve okuma iç içe yürür: sunucu, yanıtları okunmayan
+        // bağlantıdan istek okumayı durdurur; önce hepsini göndermek büyük
+        // toplu işlerde iki tarafı da kilitlerdi.
+        std::size_t sent = 0;
+        std::size_t done = 0;
+        while (done < receive_bytes) {
+            pollfd p{};
+            p.fd = m_fd;
+            p.events = static_cast<short>(POLLIN | (sent < send_bytes ? POLLOUT : 0));
+            if (::poll(&p, 1, -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                fail_system("poll");
+            }
+            if (p.revents & POLLOUT) {
+                const ssize_t n = ::send(m_fd, m_buffer.data() + sent, send_bytes - sent, MSG_NOSIGNAL | MSG_DONTWAIT);
+                if (n > 0) {
+                    sent += static_cast<std::size_t>(n);
+                } else if (n < 0 && errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK) {
+                    fail_system("Istek gonderilemedi");
+                }
+            }
+            if (p.revents & (POLLIN | POLLHUP | POLLERR)) {
+                const ssize_t n = ::recv(m_fd, received + done, receive_bytes - done, MSG_DONTWAIT);
+                if (n > 0) {
+                    done += static_cast<std::size_t>(n);
+                } else if (n == 0) {
+                    throw std::runtime_error("Servis baglantiyi kapatti");
+                } else if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK) {
+                    fail_system("Yanit okunamadi");
+                }
+            }
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            service::decode(received + i * service::response_bytes, responses[i]);
+        }
+#else
+        (void)requests;
+        (void)responses;
+        (void)count;
+#endif
+    }
+
+    // Command line
+    int run_service_main(int argc, char* argv[]) {
+        ServiceOptions options;
+        const char* path = nullptr;
+        for (int i = 0; i < argc; ++i) {
+            const std::string_view arg = argv[i];
+            if (arg == "-b" && i + 1 < argc) {
+                if (!parse_number(std::string_view(argv[++i]), options.max_batch) || options.max_batch == 0) {
+                    std::fprintf(stderr, "Hatali toplu is boyutu: %s\n", argv[i]);
+                    return 2;
+                }
+            } else if (!path && !arg.empty() && arg[0] != '-') {
+                path = argv[i];
+            } else {
+                path = nullptr;
+                break;
+            }
+        }
+        if (!path) {
+            std::fprintf(stderr, "Kullanim: --serve <soket> [-b toplu_is]\n");
+            return 2;
+        }
+#if PROJECT_DATE_HAS_EPOLL
+        std::signal(SIGINT, on_signal);
+        std::signal(SIGTERM, on_signal);
+        try {
+            const ServiceStats stats = run_service(path, options, stop_requested);
+            std::fprintf(stderr, "istek: %llu, toplu is: %llu, baglanti: %llu\n",
+                         static_cast<unsigned long long>(stats.requests),
+                         static_cast<unsigned long long>(stats.batches),
+                         static_cast<unsigned long long>(stats.connections));
+            return 0;
+        } catch (const std::exception& e) {
+            std::fprintf(stderr, "%s\n", e.what());
+            return 1;
+        }
+#else
+        std::fprintf(stderr, "Servis modu bu platformda desteklenmiyor\n");
+        return 2;
+#endif
+    }
+
+    int run_load_main(int argc, char* argv[]) {
+        unsigned connections = 4;
+        std::uint64_t total = 1'000'000;
+        std::size_t depth = 64;
+        const char* path = nullptr;
+        for (int i = 0; i < argc; ++i) {
+            const std::string_view arg = argv[i];
+            bool ok = true;
+            if (arg == "-c" && i + 1 < argc) {
+                ok = parse_number(std::string_view(argv[++i]), connections) && connections != 0;
+            } else if (arg == "-n" && i + 1 < argc) {
+                ok = parse_number(std::string_view(argv[++i]), total);
+            } else if (arg == "-d" && i + 1 < argc) {
+                ok = parse_number(std::string_view(argv[++i]), depth) && depth != 0;
+            } else if (!path && !arg.empty() && arg[0] != '-') {
+                path = argv[i];
+            } else {
+                ok = false;
+            }
+            if (!ok) {
+                path = nullptr;
+                break;
+            }
+        }
+        if (!path) {
+            std::fprintf(stderr, "Kullanim: --load <soket> [-c baglanti] [-n istek] [-d derinlik]\n");
+            return 2;
+        }
+
+        // Her bağlantı kendi iş parçacığında depth isteklik turlar gönderir;
+        // bir isteğin gecikmesi, turunun gönderilmesinden yanıtların
+        // alınmasına kadar geçen süredir.
+        std::vector<std::vector<std::uint64_t>> latencies(connections);
+        std::vector<std::uint64_t> errors(connections, 0);
+        std::vector<std::string> failures(connections);
+        const auto start = std::chrono::steady_clock::now();
+        parallel::for_each_task(connections, connections, [&](std::size_t c) {
+            try {
+                DateClient client(path);
+                DateGenerator generator(0x5EED + c);
+                std::uint64_t remaining = total / connections + (c < total % connections ? 1 : 0);
+                latencies[c].reserve(static_cast<std::size_t>(remaining));
+                std::vector<Request> requests(depth);
+                std::vector<Response> responses(depth);
+                std::uint32_t id = 0;
+                while (remaining != 0) {
+                    const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(depth, remaining));
+                    for (std::size_t k = 0; k < n; ++k, ++id) {
+                        Request& r = requests[k];
+                        r.id = id;
+                        r.op = static_cast<Op>(1 + id % 5);
+                        r.a = service::pack_date(generator.next());
+                        switch (r.op) {
+                            case Op::diff:       r.b = service::pack_date(generator.next()); break;
+                            case Op::add_days:   r.b = static_cast<std::int32_t>(id % 20000) - 10000; break;
+                            case Op::leap_check: r.a = 1900 + static_cast<std::int32_t>(id % 400); r.b = 0; break;
+                            default:             r.b = 0; break;
+                        }
+                    }
+                    const auto sent = std::chrono::steady_clock::now();
+                    client.call(requests.data(), responses.data(), n);
+                    const auto latency = static_cast<std::uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - sent).count());
+                    for (std::size_t k = 0; k < n; ++k) {
+                        latencies[c].push_back(latency);
+                        if (responses[k].status != Status::ok || responses[k].id != requests[k].id) {
+                            ++errors[c];
+                        }
+                    }
+                    remaining -= n;
+                }
+            } catch (const std::exception& e) {
+                failures[c] = e.what();
+            }
+        });
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        for (const std::string& failure : failures) {
+            if (!failure.empty()) {
+                std::fprintf(stderr, "%s\n", failure.c_str());
+                return 1;
+            }
+        }
+        std::vector<std::uint64_t> all;
+        std::uint64_t error_count = 0;
+        for (unsigned c = 0; c < connections; ++c) {
+            all.insert(all.end(), latencies[c].begin(), latencies[c].end());
+            error_count += errors[c];
+        }
+        const auto percentile = [&all](double p) {
+            if (all.empty()) {
+                return 0.0;
+            }
+            const std::size_t k = std::min(all.size() - 1, static_cast<std::size_t>(p * static_cast<double>(all.size())));
+            std::nth_element(all.begin(), all.begin() + static_cast<std::ptrdiff_t>(k), all.end());
+            return static_cast<double>(all[k]) / 1000.0;
+        };
+        const double p50 = percentile(0.50);
+        const double p99 = percentile(0.99);
+
+        std::printf("istek     : %llu\n", static_cast<unsigned long long>(all.size()));
+        std::printf("baglanti  : %u (derinlik %zu)\n", connections, depth);
+        std::printf("sure      : %.3f s\n", seconds);
+        std::printf("verim     : %.0f istek/s\n", seconds > 0 ? static_cast<double>(all.size()) / seconds : 0.0);
+        std::printf("p50       : %.1f us\n", p50);
+        std::printf("p99       : %.1f us\n", p99);
+        std::printf("hata      : %llu\n", static_cast<unsigned long long>(error_count));
+        return error_count == 0 ? 0 : 1;
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef SERVICE_MODE_H
+#define SERVICE_MODE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "date_protocol.h"
+
+// Unix soketi üzerinden tarih servisi (yalnızca Linux; epoll). Tek iş
+// parçacıklı olay döngüsü, aynı epoll_wait turunda hazır olan tüm
+// bağlantılardaki istekleri tek bir toplu işe toplar; işlemler türlerine
+// göre gruplanıp batch çekirdekleriyle (date_batch.h) hesaplanır.
+
+namespace project {
+    struct ServiceOptions {
+        std::size_t max_batch = 4096;   // tek seferde işlenen en fazla istek
+        int max_events = 256;           // epoll_wait başına olay
+    };
+
+    struct ServiceStats {
+        std::uint64_t requests = 0;
+        std::uint64_t batches = 0;
+        std::uint64_t connections = 0;
+    };
+
+    // path'te dinler (varsa eski soket dosyası silinir; path soket olmayan
+    // bir dosyaysa dokunulmaz); stop true olunca döner. Sistem çağrısı
+    // hatalarında std::runtime_error fırlatır.
+    ServiceStats run_service(const std::string& path, const ServiceOptions& options,
+                             const std::atomic<bool>& stop);
+
+    // Engelleyici istemci; bir bağlantı, bir iş parçacığı.
+    class DateClient {
+    public:
+        explicit DateClient(const std::string& path);
+        ~DateClient();
+
+        DateClient(DateClient&& other) noexcept;
+        DateClient& operator=(DateClient&& other) noexcept;
+        DateClient(const DateClient&) = delete;
+        DateClient& operator=(const DateClient&) = delete;
+
+        // count isteği gönderir ve yanıtlarını sırayla okur; gönderme ile
+        // okuma iç içe yürüdüğünden count'un üst sınırı yoktur.
+        void call(const service::Request* requests, service::Response* responses, std::size_t count);
+
+    private:
+        int m_fd = -1;
+        std::vector<unsigned char> m_buffer;
+    };
+
+    // --serve <soket>: SIGINT/SIGTERM ile durur.
+    int run_service_main(int argc, char* argv[]);
+    // --load <soket> [-c baglanti] [-n istek] [-d derinlik]: yük üretir,
+    // p50/p99 gecikme ve verimi yazar.
+    int run_load_main(int argc, char* argv[]);
+}
+
+#endif